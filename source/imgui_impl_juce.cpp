@@ -15,11 +15,18 @@
 // [x] Platform: Mouse support. Can discriminate Mouse/TouchScreen/Pen.  
 // [x] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.  
 // [x] Platform: Juce Mouse cursor extensions. See imgui_impl_juce_config.h
+// [x] Platform: Cached / custom image Mouse cursors (incl. ImGuiMouseCursor_NotAllowed). See imgui_impl_juce_mouse_cursor.h
 // [x] Platform: Override Mouse wheel scroll sensitivity.  
 // [x] Platform: Keyboard support.  
 // [x] Platform: Clipboard support.  
 // [x] Platform: Multiple ImGuiContexts support. Use case: multiple plugin instances within a DAW.  
 //     (Implementations must follow thread_local guidance in imconfig.h / imgui_impl_juce_config.h)
+// [x] Platform: Per instance feature selection (input, cursor, clipboard). See ImGui_Juce_BackendFeatures
+// [x] Platform: Compile time feature switches (input, cursor, clipboard, time source). See imgui_impl_juce_config.h
+// [x] Platform: Timeline trace export (Chrome trace event JSON / Perfetto). See imgui_impl_juce_trace.h
+// [x] Platform: Paused rendering and memory trimming of hidden / minimised editors (opt-in). See ImGui_Juce_Backend::SetContinuousRepainting()
+// [x] Platform: Detach / re-attach to owning components, pre-warmed ImGuiContext pool. See imgui_impl_juce_context_pool.h
+// [x] Renderer: Optional Juce native OpenGL renderer (alternative to imgui_impl_opengl3). See imgui_impl_juce_opengl_renderer.h
 
 // Unsupported features:
 // [ ] Gamepad input.
@@ -36,6 +43,7 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_juce.h"
+#include "imgui_internal.h" // ImGuiWindow, ImGuiTable, ImGui::GcCompactTransientWindowBuffers()
 
 #include <juce_core/system/juce_TargetPlatform.h>
 
@@ -44,16 +52,22 @@ thread_local ImGuiContext* MyImGuiTLS = nullptr;
 // Note: Since we dispatch x functions to the main thread (JUCE message thread) with juce::MessageManager::callAsync
 // It's possible for the ImGui_Juce_Backend class to be destructed before the JUCE message thread executes the dispatched function
 // Which crashes as it attempts to access ImGui_Juce_Backend class data which has already been destroyed.
-// Therefore, we use a global variable which lives outside of the scope of theImGui_Juce_Backend class
-// Setting to true on Construction, false on Destruction
-// Allowing the dispatched functions on the main thread to check this before accessing the data
-// Note that we therefore MUST always create/destroy the ImGui_Juce_Backend class on the main thread too
+// Therefore, the dispatched function holds a juce::WeakReference to the backend instance (See: m_weakThis)
+// Which is cleared on Destruction, allowing the dispatched functions on the main thread to check this before accessing the data
+// (Per instance, so destroying one backend doesn't affect other live backends, e.g. other plugin instances or pooled backends)
+// Additionally a detached backend (See: Detach()) ignores dispatched functions, as it has no owning component
+// Note that we therefore MUST always create/destroy/attach/detach the ImGui_Juce_Backend class on the main thread too
 // We ensure this is the case with JUCE_ASSERT_MESSAGE_THREAD in our main thread functions
-namespace JuceImGuiBackend
-{
-    bool g_juceImguiBackendActive = false;
-}
 
+#if Juce_ImGuiBackend_ContextAllocator
+// Note: The message thread is shared by all backends (e.g. plugin instances), so each entry point activates this backend's allocator
+// For its own scope only, restoring the previously active allocator on exit (See: ImGui_Juce_ContextAllocator::ScopedActivation)
+#define Juce_ImGuiBackend_ScopedContextAllocator() ImGui_Juce_ContextAllocator::ScopedActivation const juceImGuiScopedContextAllocator(m_contextAllocator.load())
+#else
+#define Juce_ImGuiBackend_ScopedContextAllocator()
+#endif
+
+#if Juce_ImGuiBackend_MouseInput
 //==============================================================================
 static constexpr ImGuiMouseSource ImGui_ImplJuce_MouseInputSource_ToImGuiMouseSource
 (
@@ -91,52 +105,9 @@ static ImGuiMouseButton_ ImGui_ImplJuce_MouseModifierKeys_ToImGuiMouseButton
 
     return ImGuiMouseButton_COUNT;
 }
+#endif // Juce_ImGuiBackend_MouseInput
 
-//==============================================================================
-static constexpr juce::MouseCursor::StandardCursorType ImGui_ImplJuce_ImGuiMouseCursor_ToJuceStandardCursorType
-(
-    ImGuiMouseCursor const i_imGuiMouseCursor
-)
-{
-    switch(i_imGuiMouseCursor)
-    {
-        case ImGuiMouseCursor_None: return juce::MouseCursor::StandardCursorType::NoCursor;
-        case ImGuiMouseCursor_Arrow: return juce::MouseCursor::StandardCursorType::NormalCursor;
-        case ImGuiMouseCursor_TextInput: return juce::MouseCursor::StandardCursorType::IBeamCursor;
-        case ImGuiMouseCursor_ResizeAll: return juce::MouseCursor::StandardCursorType::UpDownLeftRightResizeCursor;
-        case ImGuiMouseCursor_ResizeNS: return juce::MouseCursor::StandardCursorType::UpDownResizeCursor;
-        case ImGuiMouseCursor_ResizeEW: return juce::MouseCursor::StandardCursorType::LeftRightResizeCursor;
-        case ImGuiMouseCursor_ResizeNESW: return juce::MouseCursor::StandardCursorType::BottomLeftCornerResizeCursor;
-        case ImGuiMouseCursor_ResizeNWSE: return juce::MouseCursor::StandardCursorType::BottomRightCornerResizeCursor;
-        case ImGuiMouseCursor_Hand: return juce::MouseCursor::StandardCursorType::PointingHandCursor;
-
-        /**
-         * Note: ImGui doesn't natively support the following Juce cursor types
-         * Extend ImGuiMouseCursor_ within imgui.h wrapped with this define to support these:
-        * */
-#if Juce_ImGuiMouseCursor_Extensions
-        case ImGuiMouseCursor_ParentCursor: return juce::MouseCursor::StandardCursorType::ParentCursor;
-        case ImGuiMouseCursor_WaitCursor: return juce::MouseCursor::StandardCursorType::WaitCursor;
-        case ImGuiMouseCursor_CrosshairCursor: return juce::MouseCursor::StandardCursorType::CrosshairCursor;
-        case ImGuiMouseCursor_CopyingCursor: return juce::MouseCursor::StandardCursorType::CopyingCursor;
-        case ImGuiMouseCursor_DraggingHandCursor: return juce::MouseCursor::StandardCursorType::DraggingHandCursor;
-        case ImGuiMouseCursor_TopEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::TopEdgeResizeCursor;
-        case ImGuiMouseCursor_BottomEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::BottomEdgeResizeCursor;
-        case ImGuiMouseCursor_LeftEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::LeftEdgeResizeCursor;
-        case ImGuiMouseCursor_RightEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::RightEdgeResizeCursor;
-        case ImGuiMouseCursor_TopLeftCornerResizeCursor: return juce::MouseCursor::StandardCursorType::TopLeftCornerResizeCursor;
-        case ImGuiMouseCursor_TopRightCornerResizeCursor: return juce::MouseCursor::StandardCursorType::TopRightCornerResizeCursor;
-#endif        
-
-        default: return juce::MouseCursor::StandardCursorType::NormalCursor;
-    }
-
-    /**
-     * Juce doesn't currently support:
-     * ImGuiMouseCursor_NotAllowed
-     * */ 
-}
-
+#if Juce_ImGuiBackend_KeyboardInput
 //==============================================================================
 static ImGuiKey ImGui_ImplJuce_KeyPress_ToImGuiKey
 (
@@ -286,7 +257,9 @@ static ImGuiKey ImGui_ImplJuce_KeyPress_ToImGuiKey
     // Unsupported key code
     return ImGuiKey_None;
 }
+#endif // Juce_ImGuiBackend_KeyboardInput
 
+#if Juce_ImGuiBackend_Clipboard
 //==============================================================================
 static void ImGui_ImplJuce_SetClipboardText
 (
@@ -309,6 +282,7 @@ static char const* ImGui_ImplJuce_GetClipboardText
     imguiJuceBackend->SetClipboardText(juce::SystemClipboard::getTextFromClipboard());
     return imguiJuceBackend->GetClipboardText().toRawUTF8();
 }
+#endif // Juce_ImGuiBackend_Clipboard
 
 //==============================================================================
 ImGui_Juce_Backend::ImGui_Juce_Backend
@@ -318,67 +292,242 @@ ImGui_Juce_Backend::ImGui_Juce_Backend
     , ImGuiContext& i_imGuiContext
     , float const i_mouseWheelSensitivity /* = 1.0f */
     , bool const i_consumeKeyPresses /* = true */
-)   : m_owningComponent(i_owningComponent)
-    , m_openGLContext(i_openGLContext)
-    , m_imGuiContext(i_imGuiContext)
+    , ImGui_Juce_BackendFeatures const& i_features /* = {} */
+)   : ImGui_Juce_Backend(i_imGuiContext, i_mouseWheelSensitivity, i_consumeKeyPresses, i_features)
+{
+    Attach(i_owningComponent, i_openGLContext);
+}
+
+//==============================================================================
+ImGui_Juce_Backend::ImGui_Juce_Backend
+(
+    ImGuiContext& i_imGuiContext
+    , float const i_mouseWheelSensitivity /* = 1.0f */
+    , bool const i_consumeKeyPresses /* = true */
+    , ImGui_Juce_BackendFeatures const& i_features /* = {} */
+)   : m_imGuiContext(i_imGuiContext)
     , m_mouseWheelSensitivity(i_mouseWheelSensitivity)
     , m_consumeKeyPresses(i_consumeKeyPresses)
+    , m_features(i_features)
+    , m_updateOnMessageThread((s_updateModifierKeys && (i_features.m_mouseInput || i_features.m_keyboardInput))
+                            || (s_updateKeys && i_features.m_keyboardInput)
+                            || (s_updateMouseCursor && i_features.m_mouseCursor))
 {
     JUCE_ASSERT_MESSAGE_THREAD
 
-    // Adding mouse / key listeners must occur on the message thread
-    m_owningComponent.addMouseListener(this, false);
-    m_owningComponent.addKeyListener(this);
+    // Note: Assigned in the body, as the weak reference master (JUCE_DECLARE_WEAK_REFERENCEABLE) is declared after m_weakThis
+    m_weakThis = this;
+
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
     ImGuiIO& io = GetContextSpecificImGuiIO();
     IMGUI_CHECKVERSION();
 
-    io.SetClipboardTextFn = ImGui_ImplJuce_SetClipboardText;
-    io.GetClipboardTextFn = ImGui_ImplJuce_GetClipboardText;
-    io.ClipboardUserData = this;
+#if Juce_ImGuiBackend_Clipboard
+    if(m_features.m_clipboard)
+    {
+        io.SetClipboardTextFn = ImGui_ImplJuce_SetClipboardText;
+        io.GetClipboardTextFn = ImGui_ImplJuce_GetClipboardText;
+        io.ClipboardUserData = this;
+    }
+#endif
     io.BackendPlatformName = "imgui_impl_juce";
-    io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
-
-    JuceImGuiBackend::g_juceImguiBackendActive = true;
+#if Juce_ImGuiBackend_MouseCursor
+    if(m_features.m_mouseCursor)
+    {
+        io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;
+    }
+#endif
 }
 
 //==============================================================================
 ImGui_Juce_Backend::~ImGui_Juce_Backend()
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiBackend_ScopedContextAllocator();
+
+    Detach();
+
+    ImGuiIO& io = GetContextSpecificImGuiIO();
+    io.BackendPlatformName = nullptr;
+
+    // Note: Clears m_weakThis, so functions already dispatched to the message thread do nothing
+    masterReference.clear();
+}
+
+//==============================================================================
+void ImGui_Juce_Backend::Attach
+(
+    juce::Component& i_owningComponent
+    , juce::OpenGLContext& i_openGLContext
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    Detach();
 
-    JuceImGuiBackend::g_juceImguiBackendActive = false;
+    m_owningComponent = &i_owningComponent;
+    m_openGLContext = &i_openGLContext;
+
+    // Adding mouse / key listeners must occur on the message thread
+#if Juce_ImGuiBackend_MouseInput
+    if(m_features.m_mouseInput)
+    {
+        m_owningComponent->addMouseListener(this, false);
+    }
+#endif
+#if Juce_ImGuiBackend_KeyboardInput
+    if(m_features.m_keyboardInput)
+    {
+        m_owningComponent->addKeyListener(this);
+    }
+#endif
+
+    // Ensure the new component's mouse cursor is set on the next frame
+    m_currentImGuiMouseCursor = ImGuiMouseCursor_COUNT;
+
+#if Juce_ImGuiBackend_MemoryTrim
+    // Note: Assumed showing until the first poll, so a (re-)attached editor renders its first frame immediately
+    m_isShowing = true;
+    m_hiddenDurationMs = 0;
+    m_memoryTrimPosted = false;
+    m_repaintingPaused = false;
+    m_openGLContext->setContinuousRepainting(m_continuousRepainting);
+    startTimer(s_visibilityPollIntervalMs);
+#endif
+}
+
+//==============================================================================
+void ImGui_Juce_Backend::Detach()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiBackend_ScopedContextAllocator();
+
+    if(m_owningComponent == nullptr)
+    {
+        return;
+    }
 
     // Removing mouse / key listeners must occur on the message thread
-    m_owningComponent.removeMouseListener(this);
-    m_owningComponent.removeKeyListener(this);
+#if Juce_ImGuiBackend_MouseInput
+    if(m_features.m_mouseInput)
+    {
+        m_owningComponent->removeMouseListener(this);
+    }
+#endif
+#if Juce_ImGuiBackend_KeyboardInput
+    if(m_features.m_keyboardInput)
+    {
+        m_owningComponent->removeKeyListener(this);
+    }
+#endif
+
+#if Juce_ImGuiBackend_MemoryTrim
+    stopTimer();
+
+    // Leave the context repainting as it was set, rather than paused
+    if(m_repaintingPaused)
+    {
+        m_openGLContext->setContinuousRepainting(m_continuousRepainting);
+        m_repaintingPaused = false;
+    }
+
+    // Note: The renderer belonged to the detached openGL context
+    m_getRendererMemoryBytes = nullptr;
+    m_releaseRendererMemory = nullptr;
+#endif
 
+    m_owningComponent = nullptr;
+    m_openGLContext = nullptr;
+
+    // Release any input state held by the previous component, so keys / modifiers aren't stuck down on the next attach
     ImGuiIO& io = GetContextSpecificImGuiIO();
-    io.BackendPlatformName = nullptr;
+    io.AddFocusEvent(false);
+    io.ClearInputKeys();
+    m_modifierFlags = 0;
+
+#if Juce_ImGuiBackend_KeyboardInput
+    for(juce::KeyPress& pressedKey : m_pressedKeys)
+    {
+        pressedKey = juce::KeyPress();
+    }
+    m_currentActivePressedKeys = 0;
+    m_keyPressesToProcess.clear();
+#endif
+}
+
+//==============================================================================
+bool ImGui_Juce_Backend::IsAttached() const
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    return m_owningComponent != nullptr;
 }
 
 //==============================================================================
 void ImGui_Juce_Backend::NewFrame()
 {
     // Note: Valid to / Expected to call NewFrame() from render thread
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::NewFrame");
+
+    // Note: Attach() before attaching the openGL context to the component, Detach() after detaching it. See: Attach()
+    jassert(m_owningComponent != nullptr && m_openGLContext != nullptr);
+    if(m_owningComponent == nullptr || m_openGLContext == nullptr)
+    {
+        return;
+    }
 
     ImGuiIO& io = GetContextSpecificImGuiIO();
 
-    io.DisplaySize = ImVec2(static_cast<float>(m_owningComponent.getWidth()), static_cast<float>(m_owningComponent.getHeight()));
+    io.DisplaySize = ImVec2(static_cast<float>(m_owningComponent->getWidth()), static_cast<float>(m_owningComponent->getHeight()));
 
-    float const renderingScale = static_cast<float>(m_openGLContext.getRenderingScale());
+    float const renderingScale = static_cast<float>(m_openGLContext->getRenderingScale());
     io.DisplayFramebufferScale = ImVec2(renderingScale, renderingScale);
 
-    // Ensuring thread safety by dispatching key update functions on the main thread (Juce message thread)
-    // Note: UpdateModifierKeys() called first, in order to apply modifier to current key presses
-    juce::MessageManager::callAsync([this](){ UpdateModifierKeys(); } );
-    juce::MessageManager::callAsync([this](){ UpdateKeyPresses(); } );
-    juce::MessageManager::callAsync([this](){ UpdateKeyReleases(); } );
-    juce::MessageManager::callAsync([this](){ UpdateMouseCursor(); } );
+    // Ensuring thread safety by dispatching key / cursor update functions on the main thread (Juce message thread)
+    // Note: A single dispatch per frame (See: UpdateOnMessageThread()), which compiles away when no such features are enabled
+    // And is skipped for instances without such features (e.g. display-only)
+    if constexpr (s_updateOnMessageThread)
+    {
+        if(m_updateOnMessageThread)
+        {
+            juce::MessageManager::callAsync([weakThis = m_weakThis]()
+            {
+                if(ImGui_Juce_Backend* const imGuiJuceBackend = weakThis.get())
+                {
+                    imGuiJuceBackend->UpdateOnMessageThread();
+                }
+            });
+        }
+    }
 
+#if Juce_ImGuiBackend_TimeSource == Juce_ImGuiBackend_TimeSource_HiResCounter
     double const currentTimeSeconds = juce::Time::getMillisecondCounterHiRes() / 1000.0;
     io.DeltaTime = static_cast<float>(currentTimeSeconds - m_currentTimeSeconds);
     m_currentTimeSeconds = currentTimeSeconds;
+#elif Juce_ImGuiBackend_TimeSource == Juce_ImGuiBackend_TimeSource_MillisecondCounter
+    double const currentTimeSeconds = static_cast<double>(juce::Time::getMillisecondCounter()) / 1000.0;
+    io.DeltaTime = static_cast<float>(currentTimeSeconds - m_currentTimeSeconds);
+    m_currentTimeSeconds = currentTimeSeconds;
+#endif
+    // Note: Juce_ImGuiBackend_TimeSource_External: io.DeltaTime has been set by the user prior to NewFrame()
+
+#if Juce_ImGuiBackend_ContextAllocator
+    // Note: Activated for the frame on the render thread (the frame's allocations happen after NewFrame() returns), until EndFrame()
+    // A frame without EndFrame() keeps the originally active allocator to restore
+    if(!m_frameAllocatorActive)
+    {
+        m_previousFrameAllocator = ImGui_Juce_ContextAllocator::GetActiveAllocator();
+        m_frameAllocatorActive = true;
+    }
+
+    ImGui_Juce_ContextAllocator* const contextAllocator = m_contextAllocator.load();
+    ImGui_Juce_ContextAllocator::SetActiveAllocator(contextAllocator);
+    if(contextAllocator != nullptr)
+    {
+        contextAllocator->BeginFrame();
+    }
+#endif
 
     // Fix for occasional crash in ImGui::NewFrame when (deltaTime == 0)
     // Using proposed fixes referenced here:
@@ -390,6 +539,273 @@ void ImGui_Juce_Backend::NewFrame()
     }
 }
 
+#if Juce_ImGuiBackend_ContextAllocator
+//==============================================================================
+void ImGui_Juce_Backend::EndFrame()
+{
+    if(!m_frameAllocatorActive)
+    {
+        return;
+    }
+
+    ImGui_Juce_ContextAllocator::SetActiveAllocator(m_previousFrameAllocator.get());
+    m_previousFrameAllocator = nullptr;
+    m_frameAllocatorActive = false;
+}
+#endif
+
+//==============================================================================
+size_t ImGui_Juce_Backend::EstimateImGuiMemoryBytes
+(
+    ImGuiContext& i_imGuiContext
+)
+{
+    auto const getVectorBytes = [](auto const& i_vector)
+    {
+        return static_cast<size_t>(i_vector.Capacity) * sizeof(*i_vector.Data);
+    };
+
+    size_t memoryBytes = sizeof(ImGuiContext);
+
+    for(ImGuiWindow const* const window : i_imGuiContext.Windows)
+    {
+        memoryBytes += sizeof(ImGuiWindow);
+        memoryBytes += getVectorBytes(window->IDStack);
+
+        ImDrawList const& drawList = *window->DrawList;
+        memoryBytes += getVectorBytes(drawList.CmdBuffer);
+        memoryBytes += getVectorBytes(drawList.IdxBuffer);
+        memoryBytes += getVectorBytes(drawList.VtxBuffer);
+        memoryBytes += getVectorBytes(drawList._Path);
+    }
+
+    // Note: A shared font atlas is owned (and counted) by whoever created it
+    ImFontAtlas const& fontAtlas = *i_imGuiContext.IO.Fonts;
+    if(i_imGuiContext.FontAtlasOwnedByContext)
+    {
+        size_t const numPixels = static_cast<size_t>(fontAtlas.TexWidth) * static_cast<size_t>(fontAtlas.TexHeight);
+        memoryBytes += fontAtlas.TexPixelsAlpha8 != nullptr ? numPixels : 0;
+        memoryBytes += fontAtlas.TexPixelsRGBA32 != nullptr ? numPixels * 4 : 0;
+
+        for(ImFont const* const font : fontAtlas.Fonts)
+        {
+            memoryBytes += sizeof(ImFont);
+            memoryBytes += getVectorBytes(font->Glyphs);
+            memoryBytes += getVectorBytes(font->IndexAdvanceX);
+            memoryBytes += getVectorBytes(font->IndexLookup);
+        }
+
+        for(ImFontConfig const& fontConfig : fontAtlas.ConfigData)
+        {
+            memoryBytes += fontConfig.FontDataOwnedByAtlas ? static_cast<size_t>(fontConfig.FontDataSize) : 0;
+        }
+    }
+
+    return memoryBytes;
+}
+
+#if Juce_ImGuiBackend_MemoryTrim
+//==============================================================================
+void ImGui_Juce_Backend::SetContinuousRepainting
+(
+    bool const i_continuousRepainting
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    m_continuousRepainting = i_continuousRepainting;
+
+    if(m_openGLContext != nullptr && !m_repaintingPaused)
+    {
+        m_openGLContext->setContinuousRepainting(m_continuousRepainting);
+    }
+}
+
+//==============================================================================
+bool ImGui_Juce_Backend::ShouldRenderFrame() const
+{
+    // Note: Trimmed buffers regrow lazily within the next rendered frame (ImGui::Begin() / the renderer's next upload)
+    return m_isShowing.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+void ImGui_Juce_Backend::TrimMemory()
+{
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::TrimMemory");
+    Juce_ImGuiBackend_ScopedContextAllocator();
+
+    GetContextSpecificImGuiIO();
+    ImGuiContext& g = m_imGuiContext;
+
+    // Note: Draw lists / windows are in use between ImGui::NewFrame() and rendering the frame's ImDrawData
+    jassert(!g.WithinFrameScope);
+
+    size_t const imGuiBytesBeforeTrim = EstimateImGuiMemoryBytes(g);
+    size_t const rendererBytesBeforeTrim = m_getRendererMemoryBytes ? m_getRendererMemoryBytes() : 0;
+
+#if Juce_ImGuiBackend_ContextAllocator
+    ImGui_Juce_ContextAllocator* const contextAllocator = m_contextAllocator.load();
+    size_t const allocatorBytesBeforeTrim = contextAllocator != nullptr ? contextAllocator->GetBytesReserved() : 0;
+#else
+    size_t const allocatorBytesBeforeTrim = 0;
+#endif
+
+    // Note: The same compaction ImGui applies to windows unused for io.ConfigMemoryCompactTimer, applied to all windows now
+    // Compacted windows are restored by ImGui::Begin() (See: ImGui::GcAwakeTransientWindowBuffers())
+    for(ImGuiWindow* const window : g.Windows)
+    {
+        if(!window->MemoryCompacted)
+        {
+            ImGui::GcCompactTransientWindowBuffers(window);
+        }
+    }
+
+    for(int i = 0; i < g.Tables.GetMapSize(); ++i)
+    {
+        ImGuiTable* const table = g.Tables.TryGetMapData(i);
+        if(table != nullptr && !table->MemoryCompacted)
+        {
+            ImGui::TableGcCompactTransientBuffers(table);
+        }
+    }
+
+    for(ImGuiTableTempData& tableTempData : g.TablesTempData)
+    {
+        ImGui::TableGcCompactTransientBuffers(&tableTempData);
+    }
+
+    ImGui::GcCompactTransientMiscBuffers();
+
+    // Background / foreground draw lists (reset, then refilled, per frame)
+    for(ImGuiViewportP* const viewport : g.Viewports)
+    {
+        for(ImDrawList* const drawList : viewport->BgFgDrawLists)
+        {
+            if(drawList != nullptr)
+            {
+                drawList->_ClearFreeMemory();
+            }
+        }
+    }
+
+    if(m_releaseRendererMemory)
+    {
+        m_releaseRendererMemory();
+    }
+
+    // The compacted buffers were freed into the allocator's pools, so only now are whole pool chunks free
+#if Juce_ImGuiBackend_ContextAllocator
+    if(contextAllocator != nullptr)
+    {
+        contextAllocator->Trim();
+    }
+    size_t const allocatorBytesAfterTrim = contextAllocator != nullptr ? contextAllocator->GetBytesReserved() : 0;
+#else
+    size_t const allocatorBytesAfterTrim = 0;
+#endif
+
+    m_imGuiBytesBeforeTrim = imGuiBytesBeforeTrim;
+    m_imGuiBytesAfterTrim = EstimateImGuiMemoryBytes(g);
+    m_rendererBytesBeforeTrim = rendererBytesBeforeTrim;
+    m_rendererBytesAfterTrim = m_getRendererMemoryBytes ? m_getRendererMemoryBytes() : 0;
+    m_allocatorBytesBeforeTrim = allocatorBytesBeforeTrim;
+    m_allocatorBytesAfterTrim = allocatorBytesAfterTrim;
+    ++m_numMemoryTrims;
+}
+
+//==============================================================================
+void ImGui_Juce_Backend::SetRendererMemoryFunctions
+(
+    std::function<size_t()> i_getRendererMemoryBytes
+    , std::function<void()> i_releaseRendererMemory
+)
+{
+    m_getRendererMemoryBytes = std::move(i_getRendererMemoryBytes);
+    m_releaseRendererMemory = std::move(i_releaseRendererMemory);
+}
+
+//==============================================================================
+ImGui_Juce_Backend::MemoryTrimStatistics ImGui_Juce_Backend::GetMemoryTrimStatistics() const
+{
+    MemoryTrimStatistics memoryTrimStatistics;
+    memoryTrimStatistics.m_numTrims = m_numMemoryTrims.load();
+    memoryTrimStatistics.m_imGuiBytesBeforeTrim = m_imGuiBytesBeforeTrim.load();
+    memoryTrimStatistics.m_imGuiBytesAfterTrim = m_imGuiBytesAfterTrim.load();
+    memoryTrimStatistics.m_rendererBytesBeforeTrim = m_rendererBytesBeforeTrim.load();
+    memoryTrimStatistics.m_rendererBytesAfterTrim = m_rendererBytesAfterTrim.load();
+    memoryTrimStatistics.m_allocatorBytesBeforeTrim = m_allocatorBytesBeforeTrim.load();
+    memoryTrimStatistics.m_allocatorBytesAfterTrim = m_allocatorBytesAfterTrim.load();
+
+    return memoryTrimStatistics;
+}
+
+//==============================================================================
+void ImGui_Juce_Backend::timerCallback()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if(m_owningComponent == nullptr)
+    {
+        return;
+    }
+
+    // Note: isShowing() includes the parent hierarchy's visibility and the peer's minimised state
+    bool const isShowing = m_owningComponent->isShowing();
+    bool const wasShowing = m_isShowing.exchange(isShowing);
+
+    if(isShowing)
+    {
+        m_hiddenDurationMs = 0;
+        m_memoryTrimPosted = false;
+
+        // Frames were paused while hidden: resume, and ensure a non continuously repainting context renders the restored editor
+        if(!wasShowing)
+        {
+            if(m_repaintingPaused)
+            {
+                m_openGLContext->setContinuousRepainting(m_continuousRepainting);
+                m_repaintingPaused = false;
+            }
+
+            m_openGLContext->triggerRepaint();
+        }
+        return;
+    }
+
+    // Hidden: stop rendering frames nobody sees
+    if(wasShowing && m_continuousRepainting)
+    {
+        m_openGLContext->setContinuousRepainting(false);
+        m_repaintingPaused = true;
+    }
+
+    m_hiddenDurationMs += s_visibilityPollIntervalMs;
+    if(m_hiddenDurationMs >= s_memoryTrimDelayMs && !m_memoryTrimPosted && m_openGLContext->isAttached())
+    {
+        m_memoryTrimPosted = true;
+
+        // Trimmed on the render thread between frames, with the openGL context active for the renderer's buffers
+        // Note: Queued work is run (or discarded) before the context detaches, which precedes Detach() / destruction of this backend
+        m_openGLContext->executeOnGLThread([this](juce::OpenGLContext&)
+        {
+            TrimMemory();
+        }, false);
+    }
+}
+#endif // Juce_ImGuiBackend_MemoryTrim
+
+#if Juce_ImGuiBackend_ContextAllocator
+//==============================================================================
+void ImGui_Juce_Backend::SetContextAllocator
+(
+    ImGui_Juce_ContextAllocator* const i_contextAllocator
+)
+{
+    m_contextAllocator = i_contextAllocator;
+}
+#endif // Juce_ImGuiBackend_ContextAllocator
+
+#if Juce_ImGuiBackend_Clipboard
 //==============================================================================
 void ImGui_Juce_Backend::SetClipboardText
 (
@@ -404,6 +820,7 @@ juce::String const& ImGui_Juce_Backend::GetClipboardText() const
 {
     return m_currentClipboardText;
 }
+#endif // Juce_ImGuiBackend_Clipboard
 
 //==============================================================================
 void ImGui_Juce_Backend::SetMouseWheelSensitivity
@@ -418,6 +835,7 @@ void ImGui_Juce_Backend::SetMouseWheelSensitivity
     m_mouseWheelSensitivity = fabsf(i_mouseWheelSensitivity);
 }
 
+#if Juce_ImGuiBackend_MouseInput
 //==============================================================================
 void ImGui_Juce_Backend::mouseMove
 (
@@ -425,8 +843,10 @@ void ImGui_Juce_Backend::mouseMove
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::mouseMove");
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -463,8 +883,10 @@ void ImGui_Juce_Backend::mouseDown
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::mouseDown");
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -481,8 +903,10 @@ void ImGui_Juce_Backend::mouseDrag
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::mouseDrag");
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -499,8 +923,10 @@ void ImGui_Juce_Backend::mouseUp
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::mouseUp");
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -528,8 +954,10 @@ void ImGui_Juce_Backend::mouseWheelMove
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::mouseWheelMove");
+    Juce_ImGuiBackend_ScopedContextAllocator();
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -550,12 +978,55 @@ void ImGui_Juce_Backend::mouseMagnify
     // Currently unimplemented
 }
 
+#endif // Juce_ImGuiBackend_MouseInput
+
+//==============================================================================
+void ImGui_Juce_Backend::UpdateOnMessageThread()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::UpdateOnMessageThread");
+    Juce_ImGuiBackend_ScopedContextAllocator();
+
+    if(m_owningComponent == nullptr)
+    {
+        return;
+    }
+
+    // Note: UpdateModifierKeys() called first, in order to apply modifier to current key presses
+    if constexpr (s_updateModifierKeys)
+    {
+        if(m_features.m_mouseInput || m_features.m_keyboardInput)
+        {
+            UpdateModifierKeys();
+        }
+    }
+
+    if constexpr (s_updateKeys)
+    {
+        if(m_features.m_keyboardInput)
+        {
+            UpdateKeyPresses();
+            UpdateKeyReleases();
+        }
+    }
+
+    if constexpr (s_updateMouseCursor)
+    {
+        if(m_features.m_mouseCursor)
+        {
+            UpdateMouseCursor();
+        }
+    }
+}
+
+#if Juce_ImGuiBackend_MouseInput || Juce_ImGuiBackend_KeyboardInput
 //==============================================================================
 void ImGui_Juce_Backend::UpdateModifierKeys()
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::UpdateModifierKeys");
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -595,13 +1066,16 @@ void ImGui_Juce_Backend::UpdateModifierKeys()
 
     m_modifierFlags = currentModifierFlags;
 }
+#endif // Juce_ImGuiBackend_MouseInput || Juce_ImGuiBackend_KeyboardInput
 
+#if Juce_ImGuiBackend_KeyboardInput
 //==============================================================================
 void ImGui_Juce_Backend::UpdateKeyPresses()
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::UpdateKeyPresses");
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -668,8 +1142,9 @@ void ImGui_Juce_Backend::UpdateKeyPresses()
 void ImGui_Juce_Backend::UpdateKeyReleases()
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::UpdateKeyReleases");
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -723,13 +1198,16 @@ void ImGui_Juce_Backend::UpdateKeyReleases()
         jassert(m_currentActivePressedKeys >= 0);
     }
 }
+#endif // Juce_ImGuiBackend_KeyboardInput
 
+#if Juce_ImGuiBackend_MouseCursor
 //==============================================================================
 void ImGui_Juce_Backend::UpdateMouseCursor()
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::UpdateMouseCursor");
 
-    if(!JuceImGuiBackend::g_juceImguiBackendActive)
+    if(m_owningComponent == nullptr)
     {
         return;
     }
@@ -741,24 +1219,31 @@ void ImGui_Juce_Backend::UpdateMouseCursor()
         return;
     }
 
-    ImGuiMouseCursor const imGuiMouseCursor = ImGui::GetMouseCursor();
-    
-    if(imGuiMouseCursor == m_currentImGuiMouseCursor)
+    ImGuiMouseCursor const imGuiMouseCursor = io.MouseDrawCursor ? ImGuiMouseCursor_None : ImGui::GetMouseCursor();
+    float const renderingScale = static_cast<float>(m_openGLContext->getRenderingScale());
+
+    // Note: Custom image cursors depend on the rendering scale, e.g. when moving between displays
+    if(imGuiMouseCursor == m_currentImGuiMouseCursor && renderingScale == m_currentMouseCursorRenderingScale)
     {
         return;
     }
 
     m_currentImGuiMouseCursor = imGuiMouseCursor;
+    m_currentMouseCursorRenderingScale = renderingScale;
 
-    if (io.MouseDrawCursor || imGuiMouseCursor == ImGuiMouseCursor_None)
-    {
-        // Hide OS mouse cursor if imgui is drawing it or if it wants no cursor
-        m_owningComponent.setMouseCursor(juce::MouseCursor::StandardCursorType::NoCursor);
-        return;
-    }
+    // Note: Hides the OS mouse cursor if imgui is drawing it or if it wants no cursor (ImGuiMouseCursor_None)
+    // Note: Cursors are cached by the registry, so changing cursor never allocates or re-creates native cursor handles
+    m_owningComponent->setMouseCursor(m_mouseCursorRegistry.GetMouseCursor(imGuiMouseCursor, renderingScale));
+}
+
+//==============================================================================
+ImGui_Juce_MouseCursorRegistry& ImGui_Juce_Backend::GetMouseCursorRegistry()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
 
-    m_owningComponent.setMouseCursor(ImGui_ImplJuce_ImGuiMouseCursor_ToJuceStandardCursorType(imGuiMouseCursor));
+    return m_mouseCursorRegistry;
 }
+#endif // Juce_ImGuiBackend_MouseCursor
 
 //==============================================================================
 ImGuiIO& ImGui_Juce_Backend::GetContextSpecificImGuiIO()
@@ -769,6 +1254,7 @@ ImGuiIO& ImGui_Juce_Backend::GetContextSpecificImGuiIO()
     return ImGui::GetIO();
 }
 
+#if Juce_ImGuiBackend_KeyboardInput
 //==============================================================================
 bool ImGui_Juce_Backend::keyPressed
 (
@@ -777,6 +1263,7 @@ bool ImGui_Juce_Backend::keyPressed
 )
 {
     JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_Backend::keyPressed");
 
     /**
      * Note: This function is not called for key releases. Handled within: UpdateKeyReleases())
@@ -827,5 +1314,6 @@ bool ImGui_Juce_Backend::keyStateChanged
     // Additionally this prevents the MacOS alert beep playing on key presses
     return true;
 }
+#endif // Juce_ImGuiBackend_KeyboardInput
 
 #endif // #ifndef IMGUI_DISABLE
@@ -15,11 +15,18 @@
 // [x] Platform: Mouse support. Can discriminate Mouse/TouchScreen/Pen.  
 // [x] Platform: Mouse cursor shape and visibility. Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.  
 // [x] Platform: Juce Mouse cursor extensions. See imgui_impl_juce_config.h
+// [x] Platform: Cached / custom image Mouse cursors (incl. ImGuiMouseCursor_NotAllowed). See imgui_impl_juce_mouse_cursor.h
 // [x] Platform: Override Mouse wheel scroll sensitivity.  
 // [x] Platform: Keyboard support.  
 // [x] Platform: Clipboard support.  
 // [x] Platform: Multiple ImGuiContexts support. Use case: multiple plugin instances within a DAW.  
 //     (Implementations must follow thread_local guidance in imconfig.h / imgui_impl_juce_config.h)
+// [x] Platform: Per instance feature selection (input, cursor, clipboard). See ImGui_Juce_BackendFeatures
+// [x] Platform: Compile time feature switches (input, cursor, clipboard, time source). See imgui_impl_juce_config.h
+// [x] Platform: Timeline trace export (Chrome trace event JSON / Perfetto). See imgui_impl_juce_trace.h
+// [x] Platform: Paused rendering and memory trimming of hidden / minimised editors (opt-in). See ImGui_Juce_Backend::SetContinuousRepainting()
+// [x] Platform: Detach / re-attach to owning components, pre-warmed ImGuiContext pool. See imgui_impl_juce_context_pool.h
+// [x] Renderer: Optional Juce native OpenGL renderer (alternative to imgui_impl_opengl3). See imgui_impl_juce_opengl_renderer.h
 
 // Unsupported features:
 // [ ] Gamepad input.
@@ -40,17 +47,64 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_opengl/juce_opengl.h>
 
+#include "imgui_impl_juce_mouse_cursor.h"
+
+#if Juce_ImGuiBackend_ContextAllocator
+#include "imgui_impl_juce_allocator.h"
+#endif
+
+#if Juce_ImGuiBackend_Trace
+#include "imgui_impl_juce_trace.h"
+#else
+// Trace scopes compile away entirely when tracing is disabled
+#define Juce_ImGuiTrace_Scope(i_name)
+#endif
+
+#include <atomic>
+#include <functional>
+#include <type_traits>
+
+//==============================================================================
+namespace JuceImGuiBackend
+{
+    // Empty base substituted for a listener / timer interface whose feature is disabled (See: imgui_impl_juce_config.h)
+    template <int t_disabledFeature>
+    struct DisabledFeature {};
+
+    using MouseInputBase = std::conditional_t<Juce_ImGuiBackend_MouseInput, juce::MouseListener, DisabledFeature<0>>;
+    using KeyboardInputBase = std::conditional_t<Juce_ImGuiBackend_KeyboardInput, juce::KeyListener, DisabledFeature<1>>;
+    using VisibilityPollBase = std::conditional_t<Juce_ImGuiBackend_MemoryTrim, juce::Timer, DisabledFeature<2>>;
+}
+
+//==============================================================================
+// Per instance feature selection, e.g. a display-only meter window alongside a full input editor within the same plugin
+// Note: Features compiled out in imgui_impl_juce_config.h are unavailable regardless of these flags
+struct ImGui_Juce_BackendFeatures
+{
+    bool m_mouseInput = true;       // juce::MouseListener registration
+    bool m_keyboardInput = true;    // juce::KeyListener registration
+    bool m_mouseCursor = true;      // ImGuiBackendFlags_HasMouseCursors, cursor updates
+    bool m_clipboard = true;        // io.SetClipboardTextFn / io.GetClipboardTextFn
+};
+
 //==============================================================================
-class ImGui_Juce_Backend    : public juce::MouseListener
-                            , public juce::KeyListener
+class ImGui_Juce_Backend    : public JuceImGuiBackend::MouseInputBase
+                            , public JuceImGuiBackend::KeyboardInputBase
+                            , private JuceImGuiBackend::VisibilityPollBase
 {
 public:
     ImGui_Juce_Backend(juce::Component& i_owningComponent
                     , juce::OpenGLContext& i_openGLContext
                     , ImGuiContext& i_imGuiContext
                     , float i_mouseWheelSensitivity = 1.0f
-                    , bool i_consumeKeyPresses = true);
-    ~ImGui_Juce_Backend() override;
+                    , bool i_consumeKeyPresses = true
+                    , ImGui_Juce_BackendFeatures const& i_features = {});
+    // Detached backend, e.g. pre-warmed in a pool before its editor exists. See: Attach(), imgui_impl_juce_context_pool.h
+    explicit ImGui_Juce_Backend(ImGuiContext& i_imGuiContext
+                    , float i_mouseWheelSensitivity = 1.0f
+                    , bool i_consumeKeyPresses = true
+                    , ImGui_Juce_BackendFeatures const& i_features = {});
+    ~ImGui_Juce_Backend();
     ImGui_Juce_Backend(ImGui_Juce_Backend const&) = delete;
 
     ImGui_Juce_Backend& operator=(ImGui_Juce_Backend const&) = delete;
@@ -62,16 +116,98 @@ public:
     // Increase (Speed up) the mouse wheel sensitivity with > 1.0
     void SetMouseWheelSensitivity(float i_mouseWheelSensitivity);
 
+    //==============================================================================
+    // Re-targets the backend to another owning component / openGL context (adds the mouse / key listeners)
+    // Detach() removes the listeners and releases held keys / modifiers, keeping the ImGuiContext state (windows, fonts, settings)
+    // Note: Must be called from the main thread (Juce message thread)
+    // Attach() before attaching the openGL context to the component, Detach() after detaching it (NewFrame() requires an attached backend)
+    void Attach(juce::Component& i_owningComponent, juce::OpenGLContext& i_openGLContext);
+    void Detach();
+    bool IsAttached() const;
+
     //==============================================================================
     void NewFrame();
+#if Juce_ImGuiBackend_ContextAllocator
+    // Render thread: call at the end of juce::OpenGLRenderer::renderOpenGL(), after rendering the frame's draw data
+    // Restores the render thread's allocator activated by NewFrame() (See: SetContextAllocator())
+    // Note: The render thread is never left routing to this context's allocator between frames, e.g. for another backend's frames
+    void EndFrame();
+#endif
 
+    //==============================================================================
+    // Estimated heap memory owned by an ImGuiContext: windows, draw list buffers and (owned) font atlas
+    static size_t EstimateImGuiMemoryBytes(ImGuiContext& i_imGuiContext);
+
+#if Juce_ImGuiBackend_MemoryTrim
+    //==============================================================================
+    struct MemoryTrimStatistics
+    {
+        int m_numTrims = 0;
+        // Of the last trim. Renderer bytes are 0 without SetRendererMemoryFunctions()
+        size_t m_imGuiBytesBeforeTrim = 0;
+        size_t m_imGuiBytesAfterTrim = 0;
+        size_t m_rendererBytesBeforeTrim = 0;
+        size_t m_rendererBytesAfterTrim = 0;
+        // ImGui_Juce_ContextAllocator::GetBytesReserved(). 0 without SetContextAllocator()
+        size_t m_allocatorBytesBeforeTrim = 0;
+        size_t m_allocatorBytesAfterTrim = 0;
+    };
+
+    // While the owning component isn't showing (hidden, removed from the desktop, or its window minimised) the backend pauses
+    // The openGL context's continuous repainting, restoring it once shown (See: SetContinuousRepainting())
+    // Once hidden for s_memoryTrimDelayMs, memory is trimmed on the render thread (See: TrimMemory()). Trimmed buffers regrow on the next visible frame
+
+    // The openGL context's continuous repainting while showing (default: true, as for typical ImGui editors)
+    // Note: Use instead of juce::OpenGLContext::setContinuousRepainting(), as the backend owns the setting while attached
+    // Main thread (Juce message thread)
+    void SetContinuousRepainting(bool i_continuousRepainting);
+
+    // Optional, render thread: false while the owning component isn't showing, e.g. to skip frames triggered by repaint() while hidden
+    bool ShouldRenderFrame() const;
+
+    // Compacts ImGui's transient window / table / draw list buffers and releases the renderer's buffers
+    // Then returns the context allocator's free pool chunks to the system (See: SetContextAllocator())
+    // Note: Render thread outside of a frame, or main thread while detached (e.g. ImGui_Juce_ContextPool::Release())
+    // Called automatically for hidden editors (See: SetContinuousRepainting())
+    void TrimMemory();
+
+    // Optional: renderer buffers to report / release when trimming, called on the render thread. Cleared on Detach()
+    // E.g. ImGui_Juce_OpenGLRenderer::GetBufferMemoryBytes() / ReleaseBuffers()
+    // Or imgui_impl_opengl3: ImGui_ImplOpenGL3_DestroyDeviceObjects() (recreated lazily by ImGui_ImplOpenGL3_NewFrame())
+    // Note: Set before attaching the openGL context, or from the render thread
+    void SetRendererMemoryFunctions(std::function<size_t()> i_getRendererMemoryBytes, std::function<void()> i_releaseRendererMemory);
+
+    // Safe to call from any thread
+    MemoryTrimStatistics GetMemoryTrimStatistics() const;
+#endif
+
+#if Juce_ImGuiBackend_MouseCursor
+    //==============================================================================
+    // Cached juce::MouseCursor objects per ImGuiMouseCursor ID, including custom image cursors
+    // E.g. GetMouseCursorRegistry().RegisterCustomMouseCursor(ImGuiMouseCursor_COUNT + 0, myCursorImageFunction)
+    // Note: Must be called from the main thread (Juce message thread)
+    ImGui_Juce_MouseCursorRegistry& GetMouseCursorRegistry();
+#endif
+
+#if Juce_ImGuiBackend_ContextAllocator
+    //==============================================================================
+    // Routes this ImGuiContext's allocations to i_contextAllocator (nullptr: global malloc)
+    // The allocator is activated for the scope of each backend entry point (input listeners, message thread updates, trimming)
+    // And for the frame from NewFrame() to EndFrame() on the render thread, where its per frame statistics roll
+    // Note: The allocator must outlive the backend. See imgui_impl_juce_allocator.h for usage
+    void SetContextAllocator(ImGui_Juce_ContextAllocator* i_contextAllocator);
+#endif
+
+#if Juce_ImGuiBackend_Clipboard
     //==============================================================================
     // Used internally via ImGui_ImplJuce_SetClipboardText() and ImGui_ImplJuce_GetClipboardText()
     // (Marked public for callback user data access)
     void SetClipboardText(juce::String const& i_clipboardText);
     juce::String const& GetClipboardText() const;
+#endif
 
 private:
+#if Juce_ImGuiBackend_MouseInput
     //==============================================================================
     // juce::MouseListener overrides: juce/modules/juce_gui_basics/mouse/juce_MouseListener.h
     void mouseMove(juce::MouseEvent const& i_mouseEvent) override;
@@ -85,15 +221,32 @@ private:
                         , juce::MouseWheelDetails const& i_mouseWheelDetails) override;
     void mouseMagnify(juce::MouseEvent const& i_mouseEvent
                         , float i_scaleFactor) override;
+#endif
 
+#if Juce_ImGuiBackend_KeyboardInput
     //==============================================================================
     // juce::KeyListener overrides: juce/modules/juce_gui_basics/keyboard/juce_KeyListener.h
     bool keyPressed(juce::KeyPress const& i_keyPress
                         , juce::Component* i_originatingComponent) override;
     bool keyStateChanged(bool i_isKeyDown
                         , juce::Component* i_originatingComponent) override;
+#endif
 
+#if Juce_ImGuiBackend_MemoryTrim
     //==============================================================================
+    // juce::Timer override: polls the owning component's visibility (peer minimised state isn't broadcast by juce listeners)
+    void timerCallback() override;
+#endif
+
+    //==============================================================================
+    // Features requiring a per-frame update on the main thread (Juce message thread). See: UpdateOnMessageThread()
+    static constexpr bool s_updateModifierKeys = Juce_ImGuiBackend_MouseInput || Juce_ImGuiBackend_KeyboardInput;
+    static constexpr bool s_updateKeys = Juce_ImGuiBackend_KeyboardInput;
+    static constexpr bool s_updateMouseCursor = Juce_ImGuiBackend_MouseCursor;
+    static constexpr bool s_updateOnMessageThread = s_updateModifierKeys || s_updateKeys || s_updateMouseCursor;
+
+    //==============================================================================
+    void UpdateOnMessageThread();
     void UpdateModifierKeys();
     void UpdateKeyPresses();
     void UpdateKeyReleases();
@@ -105,22 +258,75 @@ private:
 
     //==============================================================================
     // Constructor initialisation order:
-    juce::Component& m_owningComponent;
-    juce::OpenGLContext& m_openGLContext;
     ImGuiContext& m_imGuiContext;
     float m_mouseWheelSensitivity;
     bool m_consumeKeyPresses;
+    ImGui_Juce_BackendFeatures const m_features;
+    bool const m_updateOnMessageThread;     // Any enabled feature requiring UpdateOnMessageThread()
+    // Functions dispatched to the main thread hold a weak reference, so they do nothing once the backend is destroyed
+    // Note: Created on the main thread in the constructor (juce::WeakReference master creation isn't thread safe)
+    juce::WeakReference<ImGui_Juce_Backend> m_weakThis;
+
+    //==============================================================================
+    // nullptr while detached. See: Attach()
+    juce::Component* m_owningComponent = nullptr;
+    juce::OpenGLContext* m_openGLContext = nullptr;
 
+#if Juce_ImGuiBackend_KeyboardInput
     //==============================================================================
     static constexpr int s_pressedKeyArraySize = 256;
     int m_currentActivePressedKeys = 0;
     juce::KeyPress m_pressedKeys[s_pressedKeyArraySize];
     std::vector<juce::KeyPress> m_keyPressesToProcess;
+#endif
 
+#if Juce_ImGuiBackend_Clipboard
     juce::String m_currentClipboardText;
+#endif
+
+#if Juce_ImGuiBackend_ContextAllocator
+    std::atomic<ImGui_Juce_ContextAllocator*> m_contextAllocator { nullptr };
+    // Render thread only: the allocator active before NewFrame(), restored by EndFrame()
+    juce::WeakReference<ImGui_Juce_ContextAllocator> m_previousFrameAllocator;
+    bool m_frameAllocatorActive = false;
+#endif
+
+#if Juce_ImGuiBackend_MouseCursor
+    ImGui_Juce_MouseCursorRegistry m_mouseCursorRegistry;
+    float m_currentMouseCursorRenderingScale = 0.0f;
+#endif
+
     double m_currentTimeSeconds = 0.0;
     int m_modifierFlags = 0;
     ImGuiMouseCursor m_currentImGuiMouseCursor = ImGuiMouseCursor_Arrow;
+
+#if Juce_ImGuiBackend_MemoryTrim
+    //==============================================================================
+    static constexpr int s_visibilityPollIntervalMs = 100;
+    static constexpr int s_memoryTrimDelayMs = 1000;    // Avoids trimming when quickly toggling between editors / tabs
+
+    // Written on the main thread (See: timerCallback()), read on the render thread
+    std::atomic<bool> m_isShowing { true };
+
+    // Main thread
+    int m_hiddenDurationMs = 0;
+    bool m_memoryTrimPosted = false;        // Once per hidden period
+    bool m_continuousRepainting = true;     // Applied while showing
+    bool m_repaintingPaused = false;
+
+    std::function<size_t()> m_getRendererMemoryBytes;
+    std::function<void()> m_releaseRendererMemory;
+
+    std::atomic<int> m_numMemoryTrims { 0 };
+    std::atomic<size_t> m_imGuiBytesBeforeTrim { 0 };
+    std::atomic<size_t> m_imGuiBytesAfterTrim { 0 };
+    std::atomic<size_t> m_rendererBytesBeforeTrim { 0 };
+    std::atomic<size_t> m_rendererBytesAfterTrim { 0 };
+    std::atomic<size_t> m_allocatorBytesBeforeTrim { 0 };
+    std::atomic<size_t> m_allocatorBytesAfterTrim { 0 };
+#endif
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE(ImGui_Juce_Backend)
 };
 
 #endif // #ifndef IMGUI_DISABLE
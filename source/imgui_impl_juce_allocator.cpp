@@ -0,0 +1,424 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Per-ImGuiContext allocator for the Juce Platform Backend
+// See imgui_impl_juce_allocator.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_allocator.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace JuceImGuiBackend
+{
+    // The allocator ImGui allocations are routed to on this thread (nullptr: global malloc)
+    // Note: Weakly referenced, as allocators are destroyed on other threads (e.g. the message thread, while last active on a render thread)
+    // A destroyed allocator then reads as nullptr, rather than leaving a dangling pointer in every thread it was activated on
+    thread_local juce::WeakReference<ImGui_Juce_ContextAllocator> t_activeContextAllocator;
+
+    bool g_contextAllocatorFunctionsInstalled = false;
+}
+
+//==============================================================================
+// Precedes every allocation returned to ImGui (16 bytes, preserving malloc's alignment for the returned memory)
+struct alignas(16) ImGui_Juce_ContextAllocator::AllocationHeader
+{
+    void* m_owner;          // Chunk* (pooled), ImGui_Juce_ContextAllocator* (large), nullptr (global malloc)
+    size_t m_size;          // Requested size, which also determines the size class
+};
+
+// Occupies the header slot of a free pooled block
+struct ImGui_Juce_ContextAllocator::FreeBlock
+{
+    FreeBlock* m_next;
+    Chunk* m_chunk;
+};
+
+// Precedes the blocks of a pool chunk. Each chunk serves a single size class
+struct alignas(16) ImGui_Juce_ContextAllocator::Chunk
+{
+    ImGui_Juce_ContextAllocator* m_allocator;
+    Chunk* m_next;
+    int m_sizeClass;
+    int m_numBlocks;
+    int m_liveBlocks;
+};
+
+//==============================================================================
+static int ImGui_ImplJuce_ComputeSizeClass
+(
+    size_t const i_size
+    , size_t const i_minSizeClassBytes
+)
+{
+    int sizeClass = 0;
+    size_t sizeClassBytes = i_minSizeClassBytes;
+
+    while(sizeClassBytes < i_size)
+    {
+        sizeClassBytes <<= 1;
+        sizeClass++;
+    }
+
+    return sizeClass;
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::ImGui_Juce_ContextAllocator()
+{
+    // Creates the shared weak reference up front, so activations on different threads never race to create it
+    masterReference.getSharedPointer(this);
+
+    // ImGui_Juce_ContextAllocator::InstallAllocatorFunctions() must be called before any ImGuiContext is created
+    jassert(JuceImGuiBackend::g_contextAllocatorFunctionsInstalled);
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::~ImGui_Juce_ContextAllocator()
+{
+    // The ImGuiContext must be destroyed before its allocator (all allocations returned)
+    jassert(m_totalStatistics.m_bytesLive == 0);
+
+    // Deactivates this allocator on every thread (See: JuceImGuiBackend::t_activeContextAllocator)
+    masterReference.clear();
+
+    for(Chunk*& chunks : m_chunks)
+    {
+        while(chunks != nullptr)
+        {
+            Chunk* const nextChunk = chunks->m_next;
+            std::free(chunks);
+            chunks = nextChunk;
+        }
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::InstallAllocatorFunctions()
+{
+    ImGui::SetAllocatorFunctions(ImGuiAllocFunction, ImGuiFreeFunction, nullptr);
+    JuceImGuiBackend::g_contextAllocatorFunctionsInstalled = true;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::SetActiveAllocator
+(
+    ImGui_Juce_ContextAllocator* const i_contextAllocator
+)
+{
+    JuceImGuiBackend::t_activeContextAllocator = i_contextAllocator;
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator* ImGui_Juce_ContextAllocator::GetActiveAllocator()
+{
+    return JuceImGuiBackend::t_activeContextAllocator.get();
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::ScopedActivation::ScopedActivation
+(
+    ImGui_Juce_ContextAllocator& i_contextAllocator
+)   : ScopedActivation(&i_contextAllocator)
+{
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::ScopedActivation::ScopedActivation
+(
+    ImGui_Juce_ContextAllocator* const i_contextAllocator
+)   : m_previousAllocator(GetActiveAllocator())
+{
+    SetActiveAllocator(i_contextAllocator);
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::ScopedActivation::~ScopedActivation()
+{
+    SetActiveAllocator(m_previousAllocator);
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::BeginFrame()
+{
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+
+    m_lastFrameStatistics = m_frameStatistics;
+    m_lastFrameStatistics.m_bytesLive = m_totalStatistics.m_bytesLive;
+
+    m_frameStatistics = Statistics();
+    m_frameStatistics.m_bytesPeak = m_totalStatistics.m_bytesLive;
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::Statistics ImGui_Juce_ContextAllocator::GetLastFrameStatistics() const
+{
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+    return m_lastFrameStatistics;
+}
+
+//==============================================================================
+ImGui_Juce_ContextAllocator::Statistics ImGui_Juce_ContextAllocator::GetTotalStatistics() const
+{
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+    return m_totalStatistics;
+}
+
+//==============================================================================
+size_t ImGui_Juce_ContextAllocator::GetBytesReserved() const
+{
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+    return m_bytesReserved;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::Trim()
+{
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+
+    for(int sizeClass = 0; sizeClass < s_numSizeClasses; sizeClass++)
+    {
+        // Unlink the free blocks belonging to completely free chunks
+        FreeBlock** freeBlockLink = &m_freeBlocks[sizeClass];
+        while(*freeBlockLink != nullptr)
+        {
+            if((*freeBlockLink)->m_chunk->m_liveBlocks == 0)
+            {
+                *freeBlockLink = (*freeBlockLink)->m_next;
+                continue;
+            }
+
+            freeBlockLink = &(*freeBlockLink)->m_next;
+        }
+
+        // Return the completely free chunks to the system
+        Chunk** chunkLink = &m_chunks[sizeClass];
+        while(*chunkLink != nullptr)
+        {
+            Chunk* const chunk = *chunkLink;
+
+            if(chunk->m_liveBlocks == 0)
+            {
+                *chunkLink = chunk->m_next;
+                std::free(chunk);
+                m_bytesReserved -= s_chunkBytes;
+                continue;
+            }
+
+            chunkLink = &chunk->m_next;
+        }
+    }
+}
+
+//==============================================================================
+void* ImGui_Juce_ContextAllocator::ImGuiAllocFunction
+(
+    size_t const i_size
+    , [[maybe_unused]] void* i_userData
+)
+{
+    if(ImGui_Juce_ContextAllocator* const contextAllocator = JuceImGuiBackend::t_activeContextAllocator.get())
+    {
+        return contextAllocator->Allocate(i_size);
+    }
+
+    // No active allocator on this thread: global malloc (still headed, so ImGuiFreeFunction can identify it)
+    AllocationHeader* const allocationHeader = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + i_size));
+    if(allocationHeader == nullptr)
+    {
+        return nullptr;
+    }
+
+    allocationHeader->m_owner = nullptr;
+    allocationHeader->m_size = i_size;
+    return allocationHeader + 1;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::ImGuiFreeFunction
+(
+    void* const i_ptr
+    , [[maybe_unused]] void* i_userData
+)
+{
+    if(i_ptr == nullptr)
+    {
+        return;
+    }
+
+    AllocationHeader* const allocationHeader = static_cast<AllocationHeader*>(i_ptr) - 1;
+
+    if(allocationHeader->m_owner == nullptr)
+    {
+        std::free(allocationHeader);
+        return;
+    }
+
+    // Note: Returned to the owning allocator, regardless of which allocator is active on this thread
+    if(allocationHeader->m_size > s_maxSizeClassBytes)
+    {
+        static_cast<ImGui_Juce_ContextAllocator*>(allocationHeader->m_owner)->Free(allocationHeader);
+        return;
+    }
+
+    static_cast<Chunk*>(allocationHeader->m_owner)->m_allocator->Free(allocationHeader);
+}
+
+//==============================================================================
+void* ImGui_Juce_ContextAllocator::Allocate
+(
+    size_t const i_size
+)
+{
+    if(i_size > s_maxSizeClassBytes)
+    {
+        AllocationHeader* const allocationHeader = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + i_size));
+        if(allocationHeader == nullptr)
+        {
+            return nullptr;
+        }
+
+        allocationHeader->m_owner = this;
+        allocationHeader->m_size = i_size;
+
+        juce::SpinLock::ScopedLockType const lock(m_lock);
+        m_bytesReserved += sizeof(AllocationHeader) + i_size;
+        RecordAllocation(i_size);
+
+        return allocationHeader + 1;
+    }
+
+    int const sizeClass = ImGui_ImplJuce_ComputeSizeClass(i_size, s_minSizeClassBytes);
+
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+
+    if(m_freeBlocks[sizeClass] == nullptr && !AllocateChunk(sizeClass))
+    {
+        return nullptr;
+    }
+
+    FreeBlock* const freeBlock = m_freeBlocks[sizeClass];
+    m_freeBlocks[sizeClass] = freeBlock->m_next;
+
+    Chunk* const chunk = freeBlock->m_chunk;
+    chunk->m_liveBlocks++;
+
+    AllocationHeader* const allocationHeader = reinterpret_cast<AllocationHeader*>(freeBlock);
+    allocationHeader->m_owner = chunk;
+    allocationHeader->m_size = i_size;
+
+    RecordAllocation(i_size);
+
+    return allocationHeader + 1;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::Free
+(
+    AllocationHeader* const i_allocationHeader
+)
+{
+    size_t const size = i_allocationHeader->m_size;
+
+    if(size > s_maxSizeClassBytes)
+    {
+        {
+            juce::SpinLock::ScopedLockType const lock(m_lock);
+            m_bytesReserved -= sizeof(AllocationHeader) + size;
+            RecordFree(size);
+        }
+
+        std::free(i_allocationHeader);
+        return;
+    }
+
+    Chunk* const chunk = static_cast<Chunk*>(i_allocationHeader->m_owner);
+    jassert(chunk->m_allocator == this);
+
+    juce::SpinLock::ScopedLockType const lock(m_lock);
+
+    FreeBlock* const freeBlock = reinterpret_cast<FreeBlock*>(i_allocationHeader);
+    freeBlock->m_chunk = chunk;
+    freeBlock->m_next = m_freeBlocks[chunk->m_sizeClass];
+    m_freeBlocks[chunk->m_sizeClass] = freeBlock;
+
+    chunk->m_liveBlocks--;
+    jassert(chunk->m_liveBlocks >= 0);
+
+    RecordFree(size);
+}
+
+//==============================================================================
+bool ImGui_Juce_ContextAllocator::AllocateChunk
+(
+    int const i_sizeClass
+)
+{
+    // Note: Called with m_lock held
+
+    size_t const blockBytes = sizeof(AllocationHeader) + (s_minSizeClassBytes << i_sizeClass);
+    size_t const chunkHeaderBytes = sizeof(Chunk);
+    int const numBlocks = static_cast<int>((s_chunkBytes - chunkHeaderBytes) / blockBytes);
+    jassert(numBlocks > 0);
+
+    void* const chunkMemory = std::malloc(s_chunkBytes);
+    if(chunkMemory == nullptr)
+    {
+        return false;
+    }
+
+    Chunk* const chunk = new (chunkMemory) Chunk { this, m_chunks[i_sizeClass], i_sizeClass, numBlocks, 0 };
+    m_chunks[i_sizeClass] = chunk;
+    m_bytesReserved += s_chunkBytes;
+
+    // Push the blocks in reverse, so allocations are handed out in address order
+    char* const firstBlock = static_cast<char*>(chunkMemory) + chunkHeaderBytes;
+    for(int i = numBlocks - 1; i >= 0; i--)
+    {
+        FreeBlock* const freeBlock = reinterpret_cast<FreeBlock*>(firstBlock + static_cast<size_t>(i) * blockBytes);
+        freeBlock->m_chunk = chunk;
+        freeBlock->m_next = m_freeBlocks[i_sizeClass];
+        m_freeBlocks[i_sizeClass] = freeBlock;
+    }
+
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::RecordAllocation
+(
+    size_t const i_size
+)
+{
+    // Note: Called with m_lock held
+
+    m_totalStatistics.m_bytesLive += i_size;
+    m_totalStatistics.m_bytesPeak = juce::jmax(m_totalStatistics.m_bytesPeak, m_totalStatistics.m_bytesLive);
+    m_totalStatistics.m_allocationCount++;
+
+    m_frameStatistics.m_bytesPeak = juce::jmax(m_frameStatistics.m_bytesPeak, m_totalStatistics.m_bytesLive);
+    m_frameStatistics.m_allocationCount++;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextAllocator::RecordFree
+(
+    size_t const i_size
+)
+{
+    // Note: Called with m_lock held
+
+    jassert(m_totalStatistics.m_bytesLive >= i_size);
+    m_totalStatistics.m_bytesLive -= i_size;
+    m_totalStatistics.m_freeCount++;
+
+    m_frameStatistics.m_freeCount++;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,137 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Per-ImGuiContext allocator for the Juce Platform Backend
+// Size-class pools per ImGuiContext, reporting bytes live / peak and allocation counts per frame and in total
+
+// Note: ImGui only supports a single (global) set of allocator functions, see ImGui::SetAllocatorFunctions()
+// We therefore install one set of functions, which route to the allocator active on the calling thread
+// (Following the same thread_local pattern as ImGuiContexts, see imgui_impl_juce_config.h)
+// Each allocation records its owner, so frees are always returned to the pool they came from (from any thread)
+
+// Usage:
+//  Once, before any ImGuiContext is created in this binary (e.g. plugin initialisation):
+//      ImGui_Juce_ContextAllocator::InstallAllocatorFunctions();
+//  Per ImGuiContext:
+//      m_imGuiAllocator = std::make_unique<ImGui_Juce_ContextAllocator>();
+//      {
+//          ImGui_Juce_ContextAllocator::ScopedActivation const activation(*m_imGuiAllocator);
+//          m_imGuiContext = ImGui::CreateContext();
+//      }
+//      m_imGuiJuceBackend->SetContextAllocator(m_imGuiAllocator.get()); // activates per frame / event, rolls per frame statistics
+//  Render thread, within juce::OpenGLRenderer::renderOpenGL():
+//      m_imGuiJuceBackend->NewFrame();    // activates the allocator for the frame
+//      ... ImGui::NewFrame(), ImGui::Render(), render the draw data
+//      m_imGuiJuceBackend->EndFrame();    // restores the previously active allocator
+//  Destruction: ImGui::DestroyContext() (within a ScopedActivation), then destroy the allocator
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_core/juce_core.h>
+
+#include <array>
+
+//==============================================================================
+class ImGui_Juce_ContextAllocator
+{
+public:
+    struct Statistics
+    {
+        size_t m_bytesLive = 0;         // Requested bytes currently allocated
+        size_t m_bytesPeak = 0;         // Peak of m_bytesLive (within the frame, or in total)
+        size_t m_allocationCount = 0;
+        size_t m_freeCount = 0;
+    };
+
+    ImGui_Juce_ContextAllocator();
+    ~ImGui_Juce_ContextAllocator();
+    ImGui_Juce_ContextAllocator(ImGui_Juce_ContextAllocator const&) = delete;
+
+    ImGui_Juce_ContextAllocator& operator=(ImGui_Juce_ContextAllocator const&) = delete;
+    bool operator==(ImGui_Juce_ContextAllocator const&) = delete;
+    bool operator!=(ImGui_Juce_ContextAllocator const&) = delete;
+
+    //==============================================================================
+    // Installs the ImGui allocator functions. Must be called before ImGui allocates anything in this binary
+    // (Memory allocated before installation lacks the owner header our free function relies on)
+    static void InstallAllocatorFunctions();
+
+    //==============================================================================
+    // Routes ImGui allocations on the calling thread to i_contextAllocator (nullptr: global malloc)
+    // Note: Held weakly, a destroyed allocator falls back to global malloc on every thread it was active on
+    static void SetActiveAllocator(ImGui_Juce_ContextAllocator* i_contextAllocator);
+    static ImGui_Juce_ContextAllocator* GetActiveAllocator();
+
+    class ScopedActivation
+    {
+    public:
+        explicit ScopedActivation(ImGui_Juce_ContextAllocator& i_contextAllocator);
+        explicit ScopedActivation(ImGui_Juce_ContextAllocator* i_contextAllocator);  // nullptr: global malloc
+        ~ScopedActivation();
+        ScopedActivation(ScopedActivation const&) = delete;
+        ScopedActivation& operator=(ScopedActivation const&) = delete;
+
+    private:
+        juce::WeakReference<ImGui_Juce_ContextAllocator> m_previousAllocator;
+    };
+
+    //==============================================================================
+    // Completes the current frame's statistics (See: GetLastFrameStatistics()). Called by ImGui_Juce_Backend::NewFrame()
+    void BeginFrame();
+
+    Statistics GetLastFrameStatistics() const;
+    Statistics GetTotalStatistics() const;
+
+    //==============================================================================
+    // Returns completely free pool chunks to the system. O(free blocks), so call at predictable points
+    // E.g. after closing large windows, or when the editor is hidden
+    void Trim();
+
+    // Bytes currently reserved from the system (pool chunks + large allocations)
+    size_t GetBytesReserved() const;
+
+private:
+    //==============================================================================
+    struct Chunk;
+    struct AllocationHeader;
+    struct FreeBlock;
+
+    //==============================================================================
+    static void* ImGuiAllocFunction(size_t i_size, void* i_userData);
+    static void ImGuiFreeFunction(void* i_ptr, void* i_userData);
+
+    void* Allocate(size_t i_size);
+    void Free(AllocationHeader* i_allocationHeader);
+    bool AllocateChunk(int i_sizeClass);
+    void RecordAllocation(size_t i_size);
+    void RecordFree(size_t i_size);
+
+    //==============================================================================
+    // Size classes: 16, 32, 64 ... 8192 bytes. Larger allocations (e.g. growing vertex buffers) use malloc directly
+    static constexpr int s_numSizeClasses = 10;
+    static constexpr size_t s_minSizeClassBytes = 16;
+    static constexpr size_t s_maxSizeClassBytes = s_minSizeClassBytes << (s_numSizeClasses - 1);
+    static constexpr size_t s_chunkBytes = 64 * 1024;
+
+    //==============================================================================
+    // Note: Per context, so only contended between this context's own render / message threads
+    // Statistics are also guarded by m_lock
+    mutable juce::SpinLock m_lock;
+    std::array<FreeBlock*, s_numSizeClasses> m_freeBlocks {};
+    std::array<Chunk*, s_numSizeClasses> m_chunks {};
+
+    Statistics m_totalStatistics;
+    Statistics m_frameStatistics;
+    Statistics m_lastFrameStatistics;
+    size_t m_bytesReserved = 0;
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE(ImGui_Juce_ContextAllocator)
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,442 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: ImDrawData capture stream for the Juce Platform Backend
+// See imgui_impl_juce_capture.h for usage and the capture file layout
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_capture.h"
+
+#include <cstring>
+
+static_assert(sizeof(JuceImGuiCapture::FileHeader) % 8 == 0, "Capture records must preserve 8 byte alignment");
+static_assert(sizeof(JuceImGuiCapture::ChunkHeader) % 8 == 0, "Capture records must preserve 8 byte alignment");
+static_assert(sizeof(JuceImGuiCapture::FrameHeader) % 8 == 0, "Capture records must preserve 8 byte alignment");
+static_assert(sizeof(JuceImGuiCapture::DrawListHeader) % 8 == 0, "Capture records must preserve 8 byte alignment");
+static_assert(sizeof(JuceImGuiCapture::DrawCmdRecord) % 8 == 0, "Capture records must preserve 8 byte alignment");
+
+//==============================================================================
+static void ImGui_ImplJuce_WritePadding
+(
+    juce::MemoryOutputStream& io_memoryOutputStream
+)
+{
+    static constexpr char s_padding[8] = {};
+
+    size_t const misalignment = io_memoryOutputStream.getDataSize() % 8;
+    if(misalignment != 0)
+    {
+        io_memoryOutputStream.write(s_padding, 8 - misalignment);
+    }
+}
+
+//==============================================================================
+static size_t ImGui_ImplJuce_PaddedSize
+(
+    size_t const i_size
+)
+{
+    return (i_size + 7) & ~static_cast<size_t>(7);
+}
+
+//==============================================================================
+ImGui_Juce_DrawDataCaptureWriter::ImGui_Juce_DrawDataCaptureWriter() = default;
+
+//==============================================================================
+ImGui_Juce_DrawDataCaptureWriter::~ImGui_Juce_DrawDataCaptureWriter()
+{
+    StopCapture();
+}
+
+//==============================================================================
+bool ImGui_Juce_DrawDataCaptureWriter::StartCapture
+(
+    juce::File const& i_captureFile
+)
+{
+    StopCapture();
+
+    i_captureFile.deleteFile();
+
+    // Note: A large write buffer, so the render thread rarely touches the file system
+    static constexpr size_t s_writeBufferSize = 1 << 20;
+    m_fileOutputStream = std::make_unique<juce::FileOutputStream>(i_captureFile, s_writeBufferSize);
+
+    if(m_fileOutputStream->failedToOpen())
+    {
+        m_fileOutputStream.reset();
+        return false;
+    }
+
+    JuceImGuiCapture::FileHeader fileHeader {};
+    std::memcpy(fileHeader.m_magic, JuceImGuiCapture::s_fileMagic, sizeof(fileHeader.m_magic));
+    fileHeader.m_version = JuceImGuiCapture::s_fileVersion;
+    fileHeader.m_sizeOfDrawVert = sizeof(ImDrawVert);
+    fileHeader.m_sizeOfDrawIdx = sizeof(ImDrawIdx);
+
+    m_fileOutputStream->write(&fileHeader, sizeof(fileHeader));
+    m_numFramesWritten = 0;
+
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_DrawDataCaptureWriter::StopCapture()
+{
+    if(m_fileOutputStream != nullptr)
+    {
+        m_fileOutputStream->flush();
+        m_fileOutputStream.reset();
+    }
+}
+
+//==============================================================================
+bool ImGui_Juce_DrawDataCaptureWriter::IsCapturing() const
+{
+    return m_fileOutputStream != nullptr;
+}
+
+//==============================================================================
+juce::uint64 ImGui_Juce_DrawDataCaptureWriter::GetNumFramesWritten() const
+{
+    return m_numFramesWritten;
+}
+
+//==============================================================================
+void ImGui_Juce_DrawDataCaptureWriter::WriteFrame
+(
+    ImDrawData const& i_drawData
+)
+{
+    if(m_fileOutputStream == nullptr || !i_drawData.Valid)
+    {
+        return;
+    }
+
+    m_frameChunkStream.reset();
+
+    JuceImGuiCapture::FrameHeader frameHeader {};
+    frameHeader.m_frameIndex = m_numFramesWritten;
+    frameHeader.m_timeSeconds = juce::Time::getMillisecondCounterHiRes() / 1000.0;
+    frameHeader.m_displayPos[0] = i_drawData.DisplayPos.x;
+    frameHeader.m_displayPos[1] = i_drawData.DisplayPos.y;
+    frameHeader.m_displaySize[0] = i_drawData.DisplaySize.x;
+    frameHeader.m_displaySize[1] = i_drawData.DisplaySize.y;
+    frameHeader.m_framebufferScale[0] = i_drawData.FramebufferScale.x;
+    frameHeader.m_framebufferScale[1] = i_drawData.FramebufferScale.y;
+    frameHeader.m_cmdListCount = static_cast<juce::uint32>(i_drawData.CmdListsCount);
+    frameHeader.m_totalVtxCount = static_cast<juce::uint32>(i_drawData.TotalVtxCount);
+    frameHeader.m_totalIdxCount = static_cast<juce::uint32>(i_drawData.TotalIdxCount);
+
+    m_frameChunkStream.write(&frameHeader, sizeof(frameHeader));
+
+    for(int i = 0; i < i_drawData.CmdListsCount; i++)
+    {
+        ImDrawList const* const drawList = i_drawData.CmdLists[i];
+
+        JuceImGuiCapture::DrawListHeader drawListHeader {};
+        drawListHeader.m_cmdCount = static_cast<juce::uint32>(drawList->CmdBuffer.Size);
+        drawListHeader.m_vtxCount = static_cast<juce::uint32>(drawList->VtxBuffer.Size);
+        drawListHeader.m_idxCount = static_cast<juce::uint32>(drawList->IdxBuffer.Size);
+        drawListHeader.m_flags = static_cast<juce::uint32>(drawList->Flags);
+
+        m_frameChunkStream.write(&drawListHeader, sizeof(drawListHeader));
+
+        for(ImDrawCmd const& drawCmd : drawList->CmdBuffer)
+        {
+            JuceImGuiCapture::DrawCmdRecord drawCmdRecord {};
+            drawCmdRecord.m_clipRect[0] = drawCmd.ClipRect.x;
+            drawCmdRecord.m_clipRect[1] = drawCmd.ClipRect.y;
+            drawCmdRecord.m_clipRect[2] = drawCmd.ClipRect.z;
+            drawCmdRecord.m_clipRect[3] = drawCmd.ClipRect.w;
+            drawCmdRecord.m_textureID = static_cast<juce::uint64>((intptr_t)drawCmd.GetTexID());
+            drawCmdRecord.m_vtxOffset = drawCmd.VtxOffset;
+            drawCmdRecord.m_idxOffset = drawCmd.IdxOffset;
+            drawCmdRecord.m_elemCount = drawCmd.ElemCount;
+
+            if(drawCmd.UserCallback == nullptr)
+            {
+                drawCmdRecord.m_callback = JuceImGuiCapture::DrawCmdCallback_None;
+            }
+            else if(drawCmd.UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                drawCmdRecord.m_callback = JuceImGuiCapture::DrawCmdCallback_ResetRenderState;
+            }
+            else
+            {
+                drawCmdRecord.m_callback = JuceImGuiCapture::DrawCmdCallback_User;
+            }
+
+            m_frameChunkStream.write(&drawCmdRecord, sizeof(drawCmdRecord));
+        }
+
+        if(!drawList->VtxBuffer.empty())
+        {
+            m_frameChunkStream.write(drawList->VtxBuffer.Data, static_cast<size_t>(drawList->VtxBuffer.size_in_bytes()));
+            ImGui_ImplJuce_WritePadding(m_frameChunkStream);
+        }
+
+        if(!drawList->IdxBuffer.empty())
+        {
+            m_frameChunkStream.write(drawList->IdxBuffer.Data, static_cast<size_t>(drawList->IdxBuffer.size_in_bytes()));
+            ImGui_ImplJuce_WritePadding(m_frameChunkStream);
+        }
+    }
+
+    JuceImGuiCapture::ChunkHeader chunkHeader {};
+    chunkHeader.m_type = JuceImGuiCapture::s_frameChunkType;
+    chunkHeader.m_payloadBytes = static_cast<juce::uint64>(m_frameChunkStream.getDataSize());
+
+    m_fileOutputStream->write(&chunkHeader, sizeof(chunkHeader));
+    m_fileOutputStream->write(m_frameChunkStream.getData(), m_frameChunkStream.getDataSize());
+
+    m_numFramesWritten++;
+}
+
+//==============================================================================
+ImGui_Juce_DrawDataCaptureReader::ImGui_Juce_DrawDataCaptureReader() = default;
+
+//==============================================================================
+ImGui_Juce_DrawDataCaptureReader::~ImGui_Juce_DrawDataCaptureReader() = default;
+
+//==============================================================================
+juce::Result ImGui_Juce_DrawDataCaptureReader::Open
+(
+    juce::File const& i_captureFile
+)
+{
+    Close();
+
+    m_memoryMappedFile = std::make_unique<juce::MemoryMappedFile>(i_captureFile, juce::MemoryMappedFile::readOnly);
+
+    char const* const fileData = static_cast<char const*>(m_memoryMappedFile->getData());
+    size_t const fileSize = m_memoryMappedFile->getSize();
+
+    if(fileData == nullptr || fileSize < sizeof(JuceImGuiCapture::FileHeader))
+    {
+        Close();
+        return juce::Result::fail("Unable to map capture file: " + i_captureFile.getFullPathName());
+    }
+
+    JuceImGuiCapture::FileHeader const* const fileHeader = reinterpret_cast<JuceImGuiCapture::FileHeader const*>(fileData);
+
+    if(std::memcmp(fileHeader->m_magic, JuceImGuiCapture::s_fileMagic, sizeof(fileHeader->m_magic)) != 0)
+    {
+        Close();
+        return juce::Result::fail("Not a capture file: " + i_captureFile.getFullPathName());
+    }
+
+    if(fileHeader->m_version != JuceImGuiCapture::s_fileVersion)
+    {
+        Close();
+        return juce::Result::fail("Unsupported capture file version: " + juce::String(fileHeader->m_version));
+    }
+
+    if(fileHeader->m_sizeOfDrawVert != sizeof(ImDrawVert) || fileHeader->m_sizeOfDrawIdx != sizeof(ImDrawIdx))
+    {
+        Close();
+        return juce::Result::fail("Capture was recorded with a different ImDrawVert / ImDrawIdx configuration");
+    }
+
+    // Index the frame chunks. A truncated final chunk (e.g. the capture was interrupted) is ignored
+    size_t offset = sizeof(JuceImGuiCapture::FileHeader);
+
+    while(offset + sizeof(JuceImGuiCapture::ChunkHeader) <= fileSize)
+    {
+        JuceImGuiCapture::ChunkHeader const* const chunkHeader = reinterpret_cast<JuceImGuiCapture::ChunkHeader const*>(fileData + offset);
+        size_t const payloadOffset = offset + sizeof(JuceImGuiCapture::ChunkHeader);
+
+        if(chunkHeader->m_payloadBytes > fileSize - payloadOffset)
+        {
+            break; // truncated
+        }
+
+        if(chunkHeader->m_type == JuceImGuiCapture::s_frameChunkType && chunkHeader->m_payloadBytes >= sizeof(JuceImGuiCapture::FrameHeader))
+        {
+            m_frames.push_back({ reinterpret_cast<JuceImGuiCapture::FrameHeader const*>(fileData + payloadOffset)
+                                , static_cast<size_t>(chunkHeader->m_payloadBytes) });
+        }
+
+        offset = payloadOffset + static_cast<size_t>(chunkHeader->m_payloadBytes);
+    }
+
+    return juce::Result::ok();
+}
+
+//==============================================================================
+void ImGui_Juce_DrawDataCaptureReader::Close()
+{
+    m_frames.clear();
+    m_memoryMappedFile.reset();
+}
+
+//==============================================================================
+int ImGui_Juce_DrawDataCaptureReader::GetNumFrames() const
+{
+    return static_cast<int>(m_frames.size());
+}
+
+//==============================================================================
+JuceImGuiCapture::FrameHeader const& ImGui_Juce_DrawDataCaptureReader::GetFrameHeader
+(
+    int const i_frameIndex
+) const
+{
+    jassert(juce::isPositiveAndBelow(i_frameIndex, GetNumFrames()));
+    return *m_frames[static_cast<size_t>(i_frameIndex)].m_header;
+}
+
+//==============================================================================
+void ImGui_Juce_DrawDataCaptureReader::SetTextureIDRemapFunction
+(
+    TextureIDRemapFunction i_textureIDRemapFunction
+)
+{
+    m_textureIDRemapFunction = std::move(i_textureIDRemapFunction);
+}
+
+//==============================================================================
+bool ImGui_Juce_DrawDataCaptureReader::ReadFrame
+(
+    int const i_frameIndex
+    , ImDrawData& o_drawData
+)
+{
+    jassert(juce::isPositiveAndBelow(i_frameIndex, GetNumFrames()));
+    Frame const& frame = m_frames[static_cast<size_t>(i_frameIndex)];
+    JuceImGuiCapture::FrameHeader const& frameHeader = *frame.m_header;
+
+    // Note: The counts are read from the file, so every cursor advance is checked against the frame's payload
+    char const* cursor = reinterpret_cast<char const*>(&frameHeader + 1);
+    char const* const payloadEnd = reinterpret_cast<char const*>(&frameHeader) + frame.m_payloadBytes;
+
+    auto const readRecords = [&cursor, payloadEnd](size_t const i_bytes) -> char const*
+    {
+        size_t const paddedBytes = ImGui_ImplJuce_PaddedSize(i_bytes);
+        if(paddedBytes < i_bytes || paddedBytes > static_cast<size_t>(payloadEnd - cursor))
+        {
+            return nullptr;
+        }
+
+        char const* const records = cursor;
+        cursor += paddedBytes;
+        return records;
+    };
+
+    o_drawData.Clear();
+    o_drawData.DisplayPos = ImVec2(frameHeader.m_displayPos[0], frameHeader.m_displayPos[1]);
+    o_drawData.DisplaySize = ImVec2(frameHeader.m_displaySize[0], frameHeader.m_displaySize[1]);
+    o_drawData.FramebufferScale = ImVec2(frameHeader.m_framebufferScale[0], frameHeader.m_framebufferScale[1]);
+
+    for(juce::uint32 i = 0; i < frameHeader.m_cmdListCount; i++)
+    {
+        char const* const drawListHeaderData = readRecords(sizeof(JuceImGuiCapture::DrawListHeader));
+        if(drawListHeaderData == nullptr)
+        {
+            o_drawData.Clear();
+            return false;
+        }
+
+        JuceImGuiCapture::DrawListHeader const& drawListHeader = *reinterpret_cast<JuceImGuiCapture::DrawListHeader const*>(drawListHeaderData);
+
+        size_t const cmdBytes = sizeof(JuceImGuiCapture::DrawCmdRecord) * drawListHeader.m_cmdCount;
+        size_t const vtxBytes = sizeof(ImDrawVert) * drawListHeader.m_vtxCount;
+        size_t const idxBytes = sizeof(ImDrawIdx) * drawListHeader.m_idxCount;
+
+        JuceImGuiCapture::DrawCmdRecord const* const drawCmdRecords = reinterpret_cast<JuceImGuiCapture::DrawCmdRecord const*>(readRecords(cmdBytes));
+        char const* const vtxData = readRecords(vtxBytes);
+        char const* const idxData = readRecords(idxBytes);
+        if(drawCmdRecords == nullptr || vtxData == nullptr || idxData == nullptr)
+        {
+            o_drawData.Clear();
+            return false;
+        }
+
+        // Note: Draw lists are only created once their records are known to be in the file
+        if(m_drawLists.size() <= i)
+        {
+            m_drawLists.push_back(std::make_unique<ImDrawList>(ImGui::GetDrawListSharedData()));
+        }
+
+        ImDrawList& drawList = *m_drawLists[i];
+        drawList.Flags = static_cast<ImDrawListFlags>(drawListHeader.m_flags);
+
+        // Note: resize() retains capacity, so replaying doesn't allocate once the largest frame has been seen
+        drawList.CmdBuffer.resize(0);
+
+        for(juce::uint32 cmdIndex = 0; cmdIndex < drawListHeader.m_cmdCount; cmdIndex++)
+        {
+            JuceImGuiCapture::DrawCmdRecord const& drawCmdRecord = drawCmdRecords[cmdIndex];
+
+            if(drawCmdRecord.m_callback == JuceImGuiCapture::DrawCmdCallback_User)
+            {
+                continue; // not replayable
+            }
+
+            // Commands must stay within the draw list's buffers, as renderers read them unchecked
+            if(drawCmdRecord.m_vtxOffset > drawListHeader.m_vtxCount
+                || drawCmdRecord.m_idxOffset > drawListHeader.m_idxCount
+                || drawCmdRecord.m_elemCount > drawListHeader.m_idxCount - drawCmdRecord.m_idxOffset)
+            {
+                o_drawData.Clear();
+                return false;
+            }
+
+            // As must the vertices its indices reference (ImGui renderers draw with VtxOffset as the base vertex)
+            ImDrawIdx const* const cmdIndices = reinterpret_cast<ImDrawIdx const*>(idxData) + drawCmdRecord.m_idxOffset;
+            size_t const cmdVtxCount = static_cast<size_t>(drawListHeader.m_vtxCount - drawCmdRecord.m_vtxOffset);
+
+            for(juce::uint32 element = 0; element < drawCmdRecord.m_elemCount; element++)
+            {
+                if(static_cast<size_t>(cmdIndices[element]) >= cmdVtxCount)
+                {
+                    o_drawData.Clear();
+                    return false;
+                }
+            }
+
+            ImDrawCmd drawCmd;
+            drawCmd.ClipRect = ImVec4(drawCmdRecord.m_clipRect[0], drawCmdRecord.m_clipRect[1], drawCmdRecord.m_clipRect[2], drawCmdRecord.m_clipRect[3]);
+            drawCmd.TextureId = m_textureIDRemapFunction ? m_textureIDRemapFunction(drawCmdRecord.m_textureID)
+                                                         : (ImTextureID)(intptr_t)drawCmdRecord.m_textureID;
+            drawCmd.VtxOffset = drawCmdRecord.m_vtxOffset;
+            drawCmd.IdxOffset = drawCmdRecord.m_idxOffset;
+            drawCmd.ElemCount = drawCmdRecord.m_elemCount;
+
+            if(drawCmdRecord.m_callback == JuceImGuiCapture::DrawCmdCallback_ResetRenderState)
+            {
+                drawCmd.UserCallback = ImDrawCallback_ResetRenderState;
+            }
+
+            drawList.CmdBuffer.push_back(drawCmd);
+        }
+
+        drawList.VtxBuffer.resize(static_cast<int>(drawListHeader.m_vtxCount));
+        if(vtxBytes > 0)
+        {
+            std::memcpy(drawList.VtxBuffer.Data, vtxData, vtxBytes);
+        }
+
+        drawList.IdxBuffer.resize(static_cast<int>(drawListHeader.m_idxCount));
+        if(idxBytes > 0)
+        {
+            std::memcpy(drawList.IdxBuffer.Data, idxData, idxBytes);
+        }
+
+        o_drawData.CmdLists.push_back(&drawList);
+        o_drawData.TotalVtxCount += drawList.VtxBuffer.Size;
+        o_drawData.TotalIdxCount += drawList.IdxBuffer.Size;
+    }
+
+    o_drawData.CmdListsCount = o_drawData.CmdLists.Size;
+    o_drawData.Valid = true;
+
+    return true;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,174 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: ImDrawData capture stream for the Juce Platform Backend
+// Records each frame's ImDrawData into a chunked capture file, read back in place from a memory-mapped file
+// See tools/imgui_juce_capture_replay for the standalone replay tool
+
+// Usage (render thread, within juce::OpenGLRenderer::renderOpenGL()):
+//  ImGui::Render();
+//  m_imGuiCaptureWriter.WriteFrame(*ImGui::GetDrawData());
+//  ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+// Capture file layout (native endianness, all records 8 byte aligned so they can be read in place from the mapped file):
+//  FileHeader
+//  Chunk... : ChunkHeader, followed by ChunkHeader::m_payloadBytes of payload
+//      Frame chunk payload: FrameHeader
+//                           DrawListHeader, DrawCmdRecord[m_cmdCount], ImDrawVert[m_vtxCount], ImDrawIdx[m_idxCount] (per draw list)
+// Unknown chunk types are skipped by the reader, so the format can be extended
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_core/juce_core.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+namespace JuceImGuiCapture
+{
+    static constexpr char s_fileMagic[8] = { 'J', 'I', 'M', 'G', 'C', 'A', 'P', '\0' };
+    static constexpr juce::uint32 s_fileVersion = 1;
+    static constexpr juce::uint32 s_frameChunkType = 0x454d5246; // 'FRME'
+
+    struct FileHeader
+    {
+        char m_magic[8];
+        juce::uint32 m_version;
+        juce::uint32 m_sizeOfDrawVert;      // Captures are only replayable with a matching ImDrawVert / ImDrawIdx
+        juce::uint32 m_sizeOfDrawIdx;
+        juce::uint32 m_reserved;
+    };
+
+    struct ChunkHeader
+    {
+        juce::uint32 m_type;
+        juce::uint32 m_reserved;
+        juce::uint64 m_payloadBytes;
+    };
+
+    struct FrameHeader
+    {
+        juce::uint64 m_frameIndex;
+        double m_timeSeconds;               // juce::Time::getMillisecondCounterHiRes() / 1000.0 at capture
+        float m_displayPos[2];
+        float m_displaySize[2];             // io.DisplaySize set within ImGui_Juce_Backend::NewFrame()
+        float m_framebufferScale[2];        // io.DisplayFramebufferScale set within ImGui_Juce_Backend::NewFrame()
+        juce::uint32 m_cmdListCount;
+        juce::uint32 m_totalVtxCount;
+        juce::uint32 m_totalIdxCount;
+        juce::uint32 m_reserved;
+    };
+
+    struct DrawListHeader
+    {
+        juce::uint32 m_cmdCount;
+        juce::uint32 m_vtxCount;
+        juce::uint32 m_idxCount;
+        juce::uint32 m_flags;               // ImDrawListFlags
+    };
+
+    enum DrawCmdCallback : juce::uint32
+    {
+        DrawCmdCallback_None = 0,
+        DrawCmdCallback_ResetRenderState = 1,
+        DrawCmdCallback_User = 2            // User callbacks can't be replayed, the reader skips these commands
+    };
+
+    struct DrawCmdRecord
+    {
+        float m_clipRect[4];
+        juce::uint64 m_textureID;
+        juce::uint32 m_vtxOffset;
+        juce::uint32 m_idxOffset;
+        juce::uint32 m_elemCount;
+        juce::uint32 m_callback;            // DrawCmdCallback
+    };
+}
+
+//==============================================================================
+class ImGui_Juce_DrawDataCaptureWriter
+{
+public:
+    ImGui_Juce_DrawDataCaptureWriter();
+    ~ImGui_Juce_DrawDataCaptureWriter();
+    ImGui_Juce_DrawDataCaptureWriter(ImGui_Juce_DrawDataCaptureWriter const&) = delete;
+
+    ImGui_Juce_DrawDataCaptureWriter& operator=(ImGui_Juce_DrawDataCaptureWriter const&) = delete;
+    bool operator==(ImGui_Juce_DrawDataCaptureWriter const&) = delete;
+    bool operator!=(ImGui_Juce_DrawDataCaptureWriter const&) = delete;
+
+    //==============================================================================
+    // Starts a new capture, replacing any existing file. Returns false if the file can't be opened
+    bool StartCapture(juce::File const& i_captureFile);
+    void StopCapture();
+    bool IsCapturing() const;
+
+    //==============================================================================
+    // Serialises the frame (render thread, after ImGui::Render()). Does nothing when not capturing
+    void WriteFrame(ImDrawData const& i_drawData);
+
+    juce::uint64 GetNumFramesWritten() const;
+
+private:
+    //==============================================================================
+    std::unique_ptr<juce::FileOutputStream> m_fileOutputStream;
+    juce::MemoryOutputStream m_frameChunkStream; // reused each frame, so steady state capture doesn't allocate
+    juce::uint64 m_numFramesWritten = 0;
+};
+
+//==============================================================================
+class ImGui_Juce_DrawDataCaptureReader
+{
+public:
+    // Maps a captured ImTextureID to a texture valid for the replay renderer (default: the captured value)
+    using TextureIDRemapFunction = std::function<ImTextureID(juce::uint64 i_capturedTextureID)>;
+
+    ImGui_Juce_DrawDataCaptureReader();
+    ~ImGui_Juce_DrawDataCaptureReader();
+    ImGui_Juce_DrawDataCaptureReader(ImGui_Juce_DrawDataCaptureReader const&) = delete;
+
+    ImGui_Juce_DrawDataCaptureReader& operator=(ImGui_Juce_DrawDataCaptureReader const&) = delete;
+    bool operator==(ImGui_Juce_DrawDataCaptureReader const&) = delete;
+    bool operator!=(ImGui_Juce_DrawDataCaptureReader const&) = delete;
+
+    //==============================================================================
+    // Memory-maps and indexes the capture file. Returns an error message on failure
+    juce::Result Open(juce::File const& i_captureFile);
+    void Close();
+
+    int GetNumFrames() const;
+    JuceImGuiCapture::FrameHeader const& GetFrameHeader(int i_frameIndex) const;
+
+    void SetTextureIDRemapFunction(TextureIDRemapFunction i_textureIDRemapFunction);
+
+    //==============================================================================
+    // Reconstructs the frame into o_drawData. The draw lists are owned by the reader and reused for each call
+    // Returns false (with o_drawData cleared) if the frame's records don't fit its chunk, its draw commands exceed its buffers
+    // Or an index references a vertex outside its draw list (relative to the command's VtxOffset)
+    // Note: Requires a current ImGuiContext (draw lists reference ImGui's shared draw list data)
+    bool ReadFrame(int i_frameIndex, ImDrawData& o_drawData);
+
+private:
+    //==============================================================================
+    struct Frame
+    {
+        JuceImGuiCapture::FrameHeader const* m_header;
+        size_t m_payloadBytes;              // Including the FrameHeader
+    };
+
+    //==============================================================================
+    std::unique_ptr<juce::MemoryMappedFile> m_memoryMappedFile;
+    std::vector<Frame> m_frames;
+    std::vector<std::unique_ptr<ImDrawList>> m_drawLists;
+    TextureIDRemapFunction m_textureIDRemapFunction;
+};
+
+#endif // #ifndef IMGUI_DISABLE
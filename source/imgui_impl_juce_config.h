@@ -31,4 +31,63 @@ extern thread_local ImGuiContext* MyImGuiTLS;
 #define GImGui MyImGuiTLS
 
 // Juce_ImGuiMouseCursor_Extensions: Enable with 1, Disable with 0
-#define Juce_ImGuiMouseCursor_Extensions 1
\ No newline at end of file
+#define Juce_ImGuiMouseCursor_Extensions 1
+
+/**
+ * ImGui_Juce_Backend compile time feature switches:
+ * Disabled features compile away entirely (no listener registration, virtual dispatch or per-frame message thread dispatch)
+ * Enabled features are selected per backend instance with ImGui_Juce_BackendFeatures (all enabled by default)
+ * E.g. a display-only meter window (no juce::MouseListener / juce::KeyListener, no per-frame posts) alongside a full input editor
+ * Each feature may also be overridden by the build system (e.g. -DJuce_ImGuiBackend_KeyboardInput=0)
+ * */
+
+// Juce_ImGuiBackend_MouseInput: Mouse / touch / pen input via juce::MouseListener. Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_MouseInput
+#define Juce_ImGuiBackend_MouseInput 1
+#endif
+
+// Juce_ImGuiBackend_KeyboardInput: Keyboard input via juce::KeyListener. Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_KeyboardInput
+#define Juce_ImGuiBackend_KeyboardInput 1
+#endif
+
+// Juce_ImGuiBackend_MouseCursor: Mouse cursor shape and visibility. Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_MouseCursor
+#define Juce_ImGuiBackend_MouseCursor 1
+#endif
+
+// Juce_ImGuiBackend_Clipboard: Clipboard support via juce::SystemClipboard. Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_Clipboard
+#define Juce_ImGuiBackend_Clipboard 1
+#endif
+
+// Juce_ImGuiBackend_TimeSource: Source of io.DeltaTime within ImGui_Juce_Backend::NewFrame()
+// HiResCounter: juce::Time::getMillisecondCounterHiRes()
+// MillisecondCounter: juce::Time::getMillisecondCounter() (cheaper, millisecond resolution)
+// External: io.DeltaTime is set by the user before calling NewFrame() (e.g. from a vsync / host timestamp)
+#define Juce_ImGuiBackend_TimeSource_HiResCounter 0
+#define Juce_ImGuiBackend_TimeSource_MillisecondCounter 1
+#define Juce_ImGuiBackend_TimeSource_External 2
+
+#ifndef Juce_ImGuiBackend_TimeSource
+#define Juce_ImGuiBackend_TimeSource Juce_ImGuiBackend_TimeSource_HiResCounter
+#endif
+
+// Juce_ImGuiBackend_ContextAllocator: Per-ImGuiContext allocator support, requires imgui_impl_juce_allocator.h/.cpp
+// See: ImGui_Juce_Backend::SetContextAllocator(). Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_ContextAllocator
+#define Juce_ImGuiBackend_ContextAllocator 0
+#endif
+
+// Juce_ImGuiBackend_Trace: Timeline trace events (Chrome trace event JSON), requires imgui_impl_juce_trace.h/.cpp
+// See: ImGui_Juce_TraceSession and Juce_ImGuiTrace_Scope(). Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_Trace
+#define Juce_ImGuiBackend_Trace 0
+#endif
+
+// Juce_ImGuiBackend_MemoryTrim: Pause continuous repainting and trim memory of hidden / minimised editors (polls visibility with a juce::Timer)
+// Opt-in, as the backend then owns the openGL context's continuous repainting. See: ImGui_Juce_Backend::SetContinuousRepainting()
+// Enable with 1, Disable with 0
+#ifndef Juce_ImGuiBackend_MemoryTrim
+#define Juce_ImGuiBackend_MemoryTrim 0
+#endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Pre-warmed ImGuiContext pool for the Juce Platform Backend
+// See imgui_impl_juce_context_pool.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_context_pool.h"
+
+//==============================================================================
+namespace JuceImGuiContextPool
+{
+    // Restores the calling thread's current ImGuiContext on scope exit
+    // (Pool functions are called from editor constructors / destructors, which may sit between another context's frames)
+    class ScopedCurrentContextRestore
+    {
+    public:
+        ScopedCurrentContextRestore() : m_previousContext(ImGui::GetCurrentContext()) {}
+        ~ScopedCurrentContextRestore() { ImGui::SetCurrentContext(m_previousContext); }
+        ScopedCurrentContextRestore(ScopedCurrentContextRestore const&) = delete;
+
+        ScopedCurrentContextRestore& operator=(ScopedCurrentContextRestore const&) = delete;
+
+    private:
+        ImGuiContext* const m_previousContext;
+    };
+}
+
+//==============================================================================
+ImGui_Juce_PooledContext::ImGui_Juce_PooledContext
+(
+    ImGuiContext& i_imGuiContext
+#if Juce_ImGuiBackend_ContextAllocator
+    , std::unique_ptr<ImGui_Juce_ContextAllocator> i_contextAllocator
+#endif
+    , float const i_mouseWheelSensitivity
+    , bool const i_consumeKeyPresses
+    , ImGui_Juce_BackendFeatures const& i_features
+)   : m_imGuiContext(i_imGuiContext)
+    , m_backend(std::make_unique<ImGui_Juce_Backend>(i_imGuiContext, i_mouseWheelSensitivity, i_consumeKeyPresses, i_features))
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+#if Juce_ImGuiBackend_ContextAllocator
+    m_contextAllocator = std::move(i_contextAllocator);
+    m_backend->SetContextAllocator(m_contextAllocator.get());
+#endif
+}
+
+//==============================================================================
+ImGui_Juce_PooledContext::~ImGui_Juce_PooledContext()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    JuceImGuiContextPool::ScopedCurrentContextRestore const currentContextRestore;
+#if Juce_ImGuiBackend_ContextAllocator
+    // Note: The allocator itself is destroyed after this destructor's body, so after its ImGuiContext
+    ImGui_Juce_ContextAllocator::ScopedActivation const allocatorActivation(m_contextAllocator.get());
+#endif
+
+    // Note: The backend clears its io callbacks on destruction, so must be destroyed before its ImGuiContext
+    m_backend.reset();
+    ImGui::DestroyContext(&m_imGuiContext);
+}
+
+//==============================================================================
+ImGuiContext& ImGui_Juce_PooledContext::GetImGuiContext()
+{
+    return m_imGuiContext;
+}
+
+//==============================================================================
+ImGui_Juce_Backend& ImGui_Juce_PooledContext::GetBackend()
+{
+    return *m_backend;
+}
+
+#if Juce_ImGuiBackend_ContextAllocator
+//==============================================================================
+ImGui_Juce_ContextAllocator* ImGui_Juce_PooledContext::GetContextAllocator()
+{
+    return m_contextAllocator.get();
+}
+#endif
+
+//==============================================================================
+ImGui_Juce_ContextPool::ImGui_Juce_ContextPool
+(
+    Settings const& i_settings
+    , SetupContextFunction i_setupContextFunction
+)   : m_settings(i_settings)
+    , m_setupContextFunction(std::move(i_setupContextFunction))
+{
+    jassert(m_settings.m_maxPooledContexts >= 0);
+}
+
+//==============================================================================
+ImGui_Juce_ContextPool::~ImGui_Juce_ContextPool()
+{
+    // Note: Acquired contexts must be destroyed or released before the pool (the setup function may reference the pool's owner)
+    Clear();
+}
+
+//==============================================================================
+std::unique_ptr<ImGui_Juce_PooledContext> ImGui_Juce_ContextPool::Acquire
+(
+    juce::Component& i_owningComponent
+    , juce::OpenGLContext& i_openGLContext
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_ContextPool::Acquire");
+
+    std::unique_ptr<ImGui_Juce_PooledContext> pooledContext;
+
+    // Note: Most recently released first, as its allocations are the most likely to still be cache / page resident
+    if(!m_pooledContexts.empty())
+    {
+        pooledContext = std::move(m_pooledContexts.back());
+        m_pooledContexts.pop_back();
+    }
+    else
+    {
+        pooledContext = CreatePooledContext();
+    }
+
+    pooledContext->GetBackend().Attach(i_owningComponent, i_openGLContext);
+
+    return pooledContext;
+}
+
+//==============================================================================
+void ImGui_Juce_ContextPool::Release
+(
+    std::unique_ptr<ImGui_Juce_PooledContext> i_pooledContext
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_ContextPool::Release");
+
+    if(i_pooledContext == nullptr)
+    {
+        return;
+    }
+
+    JuceImGuiContextPool::ScopedCurrentContextRestore const currentContextRestore;
+
+    i_pooledContext->GetBackend().Detach();
+#if Juce_ImGuiBackend_MemoryTrim
+    // Pooled contexts hold only what the next open needs: draw list / window buffers regrow on its first frame
+    i_pooledContext->GetBackend().TrimMemory();
+#endif
+    i_pooledContext->m_estimatedMemoryBytes = ImGui_Juce_Backend::EstimateImGuiMemoryBytes(i_pooledContext->GetImGuiContext());
+
+    m_pooledContexts.push_back(std::move(i_pooledContext));
+    EvictOverLimits();
+}
+
+//==============================================================================
+void ImGui_Juce_ContextPool::Prewarm
+(
+    int const i_numContexts
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    Juce_ImGuiTrace_Scope("ImGui_Juce_ContextPool::Prewarm");
+
+    int const numContexts = juce::jmin(i_numContexts, m_settings.m_maxPooledContexts);
+    while(static_cast<int>(m_pooledContexts.size()) < numContexts)
+    {
+        std::unique_ptr<ImGui_Juce_PooledContext> pooledContext = CreatePooledContext();
+        pooledContext->m_estimatedMemoryBytes = ImGui_Juce_Backend::EstimateImGuiMemoryBytes(pooledContext->GetImGuiContext());
+
+        if(GetPooledMemoryBytes() + pooledContext->m_estimatedMemoryBytes > m_settings.m_maxPooledBytes)
+        {
+            // Over the memory cap, so further contexts would be evicted immediately
+            break;
+        }
+
+        // Note: Inserted at the front (oldest), so contexts released by closed editors are preferred by Acquire()
+        m_pooledContexts.insert(m_pooledContexts.begin(), std::move(pooledContext));
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_ContextPool::Clear()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    m_pooledContexts.clear();
+}
+
+//==============================================================================
+int ImGui_Juce_ContextPool::GetNumPooledContexts() const
+{
+    return static_cast<int>(m_pooledContexts.size());
+}
+
+//==============================================================================
+size_t ImGui_Juce_ContextPool::GetPooledMemoryBytes() const
+{
+    size_t pooledMemoryBytes = 0;
+    for(std::unique_ptr<ImGui_Juce_PooledContext> const& pooledContext : m_pooledContexts)
+    {
+        pooledMemoryBytes += pooledContext->m_estimatedMemoryBytes;
+    }
+
+    return pooledMemoryBytes;
+}
+
+//==============================================================================
+std::unique_ptr<ImGui_Juce_PooledContext> ImGui_Juce_ContextPool::CreatePooledContext() const
+{
+    Juce_ImGuiTrace_Scope("ImGui_Juce_ContextPool::CreatePooledContext");
+
+    JuceImGuiContextPool::ScopedCurrentContextRestore const currentContextRestore;
+
+#if Juce_ImGuiBackend_ContextAllocator
+    // Note: One allocator per context, active for everything the new context allocates here (context, setup, font atlas, backend)
+    std::unique_ptr<ImGui_Juce_ContextAllocator> contextAllocator;
+    if(m_settings.m_useContextAllocator)
+    {
+        contextAllocator = std::make_unique<ImGui_Juce_ContextAllocator>();
+    }
+
+    ImGui_Juce_ContextAllocator::ScopedActivation const allocatorActivation(contextAllocator.get());
+#endif
+
+    ImGuiContext* const imGuiContext = ImGui::CreateContext();
+    ImGui::SetCurrentContext(imGuiContext);
+
+    if(m_setupContextFunction)
+    {
+        m_setupContextFunction(*imGuiContext);
+    }
+
+    // Build the font atlas now, rather than within the first frame
+    // Note: GetTexDataAsRGBA32() builds and converts the atlas to the format both imgui_impl_opengl3 and ImGui_Juce_OpenGLRenderer upload
+    // (An atlas already loaded by ImGui_Juce_FontAtlasCache in the setup function is only converted)
+    unsigned char* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    return std::make_unique<ImGui_Juce_PooledContext>(*imGuiContext
+#if Juce_ImGuiBackend_ContextAllocator
+                                                    , std::move(contextAllocator)
+#endif
+                                                    , m_settings.m_mouseWheelSensitivity
+                                                    , m_settings.m_consumeKeyPresses
+                                                    , m_settings.m_features);
+}
+
+//==============================================================================
+void ImGui_Juce_ContextPool::EvictOverLimits()
+{
+    // Note: Oldest first, so the most recently released context is kept if it fits within the limits alone
+    while(!m_pooledContexts.empty())
+    {
+        bool const overMaxContexts = static_cast<int>(m_pooledContexts.size()) > m_settings.m_maxPooledContexts;
+        bool const overMaxBytes = GetPooledMemoryBytes() > m_settings.m_maxPooledBytes;
+        if(!overMaxContexts && !overMaxBytes)
+        {
+            break;
+        }
+
+        m_pooledContexts.erase(m_pooledContexts.begin());
+    }
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,144 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Pre-warmed ImGuiContext pool for the Juce Platform Backend
+// Keeps ImGuiContexts + backends after their editor closes, detached from the owning juce::Component
+// Acquire() re-attaches a pooled context, with its fonts already built and its window state retained
+
+// Usage (main thread / Juce message thread), with the pool owned by something outliving its editors, e.g. the AudioProcessor:
+//  m_imGuiContextPool = std::make_unique<ImGui_Juce_ContextPool>(ImGui_Juce_ContextPool::Settings{}, [](ImGuiContext&)
+//  {
+//      // Called with the new ImGuiContext current: add fonts, set style / io.IniFilename...
+//      ImGui::GetIO().Fonts->AddFontFromMemoryTTF(...);
+//  });
+//  m_imGuiContextPool->Prewarm(1);    // Optional, e.g. on plugin initialisation so even the first open is warm
+//  Editor constructor (before m_openGLContext.attachTo(*this)):
+//      m_pooledImGuiContext = m_imGuiContextPool->Acquire(*this, m_openGLContext);
+//      Then use m_pooledImGuiContext->GetImGuiContext() / GetBackend() as normal
+//  Editor destructor (after m_openGLContext.detach(), once the renderer was shut down in openGLContextClosing()):
+//      m_imGuiContextPool->Release(std::move(m_pooledImGuiContext));
+
+// Note: Renderer objects (GL textures, buffers, shaders) belong to the editor's openGL context, which is destroyed with the editor
+// The pool therefore keeps the CPU side warm, the renderer's Init() only re-uploads the already built font atlas
+// Note: A pooled context retains its windows / settings state, so use one pool per AudioProcessor instance to keep UI state per instance
+// Note: With Settings::m_useContextAllocator, each pooled context owns its ImGui_Juce_ContextAllocator (See: imgui_impl_juce_allocator.h)
+// Created before its ImGuiContext and destroyed after it, so pooled / evicted contexts each return their own pool memory
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include "imgui_impl_juce.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+// An ImGuiContext, its (attached or detached) backend and optionally its allocator. Destroys all on destruction
+class ImGui_Juce_PooledContext
+{
+public:
+    // Note: i_contextAllocator (may be nullptr) must be the allocator i_imGuiContext was created with
+    ImGui_Juce_PooledContext(ImGuiContext& i_imGuiContext
+#if Juce_ImGuiBackend_ContextAllocator
+                        , std::unique_ptr<ImGui_Juce_ContextAllocator> i_contextAllocator
+#endif
+                        , float i_mouseWheelSensitivity
+                        , bool i_consumeKeyPresses
+                        , ImGui_Juce_BackendFeatures const& i_features);
+    ~ImGui_Juce_PooledContext();
+    ImGui_Juce_PooledContext(ImGui_Juce_PooledContext const&) = delete;
+
+    ImGui_Juce_PooledContext& operator=(ImGui_Juce_PooledContext const&) = delete;
+    bool operator==(ImGui_Juce_PooledContext const&) = delete;
+    bool operator!=(ImGui_Juce_PooledContext const&) = delete;
+
+    //==============================================================================
+    ImGuiContext& GetImGuiContext();
+    ImGui_Juce_Backend& GetBackend();
+#if Juce_ImGuiBackend_ContextAllocator
+    ImGui_Juce_ContextAllocator* GetContextAllocator();     // nullptr without Settings::m_useContextAllocator
+#endif
+
+private:
+    friend class ImGui_Juce_ContextPool;
+
+    //==============================================================================
+    // Constructor initialisation order:
+#if Juce_ImGuiBackend_ContextAllocator
+    // Note: The allocator is declared first, so is destroyed after the ImGuiContext (See: ~ImGui_Juce_PooledContext())
+    std::unique_ptr<ImGui_Juce_ContextAllocator> m_contextAllocator;
+#endif
+    ImGuiContext& m_imGuiContext;
+    std::unique_ptr<ImGui_Juce_Backend> m_backend;
+
+    //==============================================================================
+    size_t m_estimatedMemoryBytes = 0;  // Updated on Release()
+};
+
+//==============================================================================
+class ImGui_Juce_ContextPool
+{
+public:
+    struct Settings
+    {
+        int m_maxPooledContexts = 2;                        // Detached contexts kept alive, 0: no pooling
+        size_t m_maxPooledBytes = 32 * 1024 * 1024;         // Estimated memory of all detached contexts (See: ImGui_Juce_Backend::EstimateImGuiMemoryBytes())
+        bool m_consumeKeyPresses = true;                    // See: ImGui_Juce_Backend
+        float m_mouseWheelSensitivity = 1.0f;               // See: ImGui_Juce_Backend::SetMouseWheelSensitivity()
+        ImGui_Juce_BackendFeatures m_features;              // Per pooled backend, See: ImGui_Juce_BackendFeatures
+#if Juce_ImGuiBackend_ContextAllocator
+        bool m_useContextAllocator = false;                 // An ImGui_Juce_ContextAllocator per context, See: ImGui_Juce_PooledContext
+#endif
+    };
+
+    // Called with the new ImGuiContext current, before its font atlas is built
+    using SetupContextFunction = std::function<void(ImGuiContext& io_imGuiContext)>;
+
+    ImGui_Juce_ContextPool(Settings const& i_settings, SetupContextFunction i_setupContextFunction);
+    ~ImGui_Juce_ContextPool();
+    ImGui_Juce_ContextPool(ImGui_Juce_ContextPool const&) = delete;
+
+    ImGui_Juce_ContextPool& operator=(ImGui_Juce_ContextPool const&) = delete;
+    bool operator==(ImGui_Juce_ContextPool const&) = delete;
+    bool operator!=(ImGui_Juce_ContextPool const&) = delete;
+
+    //==============================================================================
+    // Note: All functions must be called from the main thread (Juce message thread)
+
+    // Returns a context attached to i_owningComponent, re-using the most recently released context if available
+    std::unique_ptr<ImGui_Juce_PooledContext> Acquire(juce::Component& i_owningComponent, juce::OpenGLContext& i_openGLContext);
+
+    // Detaches the context and keeps it for the next Acquire(), evicting the oldest contexts over the pool size / memory cap
+    void Release(std::unique_ptr<ImGui_Juce_PooledContext> i_pooledContext);
+
+    // Creates detached contexts until i_numContexts are pooled (within the pool size / memory cap)
+    void Prewarm(int i_numContexts);
+
+    // Destroys all detached contexts, e.g. when the host signals memory pressure
+    void Clear();
+
+    //==============================================================================
+    int GetNumPooledContexts() const;
+    size_t GetPooledMemoryBytes() const;
+
+private:
+    //==============================================================================
+    std::unique_ptr<ImGui_Juce_PooledContext> CreatePooledContext() const;
+    void EvictOverLimits();
+
+    //==============================================================================
+    // Constructor initialisation order:
+    Settings m_settings;
+    SetupContextFunction m_setupContextFunction;
+
+    //==============================================================================
+    std::vector<std::unique_ptr<ImGui_Juce_PooledContext>> m_pooledContexts;   // Oldest first
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,580 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: On-disk font atlas cache for the Juce Platform Backend
+// See imgui_impl_juce_font_atlas_cache.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_font_atlas_cache.h"
+#include "imgui_internal.h" // ImFontAtlasGetBuilderForStbTruetype()
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Cache file layout (native endianness, only read back by the same binary / imgui version):
+//  FileHeader
+//  FontRecord, ImFontGlyph[m_numGlyphs] (per font, in ImFontAtlas::Fonts order)
+//  CustomRectRecord, ImFontAtlasCustomRect (per custom rect, ImFont pointer replaced by m_fontIndex)
+//  Alpha8 pixels[m_texWidth * m_texHeight]
+namespace JuceImGuiFontAtlasCache
+{
+    static constexpr char s_fileMagic[8] = { 'J', 'I', 'M', 'G', 'F', 'N', 'T', '\0' };
+    static constexpr juce::uint32 s_fileVersion = 1;
+    static constexpr char const* s_fileExtension = ".imfontatlas";
+    static constexpr int s_maxTextureSize = 16384;
+
+    struct FileHeader
+    {
+        char m_magic[8];
+        juce::uint32 m_version;
+        juce::uint32 m_imguiVersionNum;
+        juce::uint64 m_key;
+        juce::uint32 m_sizeOfFontGlyph;
+        juce::uint32 m_sizeOfCustomRect;
+        juce::int32 m_texWidth;
+        juce::int32 m_texHeight;
+        float m_texUvScale[2];
+        float m_texUvWhitePixel[2];
+        float m_texUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1][4];
+        juce::int32 m_numFonts;
+        juce::int32 m_numCustomRects;
+        juce::int32 m_packIdMouseCursor;
+        juce::int32 m_packIdLines;
+    };
+
+    struct FontRecord
+    {
+        float m_fontSize;
+        float m_ascent;
+        float m_descent;
+        juce::int32 m_metricsTotalSurface;
+        juce::int32 m_numGlyphs;
+        juce::int32 m_reserved;
+    };
+
+    struct CustomRectRecord
+    {
+        juce::int32 m_fontIndex;            // -1: no font
+        juce::int32 m_reserved;
+    };
+
+    //==============================================================================
+    // Bounds checked reads from the memory-mapped cache file
+    class MemoryReader
+    {
+    public:
+        MemoryReader(void const* i_data, size_t i_size)
+            : m_data(static_cast<juce::uint8 const*>(i_data))
+            , m_size(i_size)
+        {
+        }
+
+        bool Read(void* o_destination, size_t i_bytes)
+        {
+            void const* const source = Skip(i_bytes);
+            if(source == nullptr)
+            {
+                return false;
+            }
+
+            std::memcpy(o_destination, source, i_bytes);
+            return true;
+        }
+
+        // Returns a pointer to the next i_bytes (nullptr if out of bounds) and advances past them
+        void const* Skip(size_t i_bytes)
+        {
+            if(i_bytes > m_size - m_position)
+            {
+                return nullptr;
+            }
+
+            void const* const data = m_data + m_position;
+            m_position += i_bytes;
+            return data;
+        }
+
+    private:
+        juce::uint8 const* m_data;
+        size_t m_size;
+        size_t m_position = 0;
+    };
+
+    //==============================================================================
+    // 64 bit FNV-1a. Note: hashing large (e.g. CJK) font data is a few milliseconds, versus the hundreds saved by not rasterising
+    class KeyHasher
+    {
+    public:
+        void Add(void const* i_data, size_t i_size)
+        {
+            juce::uint8 const* const bytes = static_cast<juce::uint8 const*>(i_data);
+
+            for(size_t i = 0; i < i_size; i++)
+            {
+                m_hash = (m_hash ^ bytes[i]) * 1099511628211ull;
+            }
+        }
+
+        template <typename T>
+        void Add(T const i_value)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only hash values with a defined representation");
+            Add(&i_value, sizeof(T));
+        }
+
+        juce::uint64 GetHash() const
+        {
+            return m_hash;
+        }
+
+    private:
+        juce::uint64 m_hash = 14695981039346656037ull;
+    };
+}
+
+static_assert(sizeof(ImFontAtlas::TexUvLines) == sizeof(JuceImGuiFontAtlasCache::FileHeader::m_texUvLines), "TexUvLines layout mismatch");
+
+//==============================================================================
+static int ImGui_ImplJuce_FindFontIndex
+(
+    ImFontAtlas const& i_fontAtlas
+    , ImFont const* const i_font
+)
+{
+    for(int fontIndex = 0; fontIndex < i_fontAtlas.Fonts.Size; fontIndex++)
+    {
+        if(i_fontAtlas.Fonts[fontIndex] == i_font)
+        {
+            return fontIndex;
+        }
+    }
+
+    return -1;
+}
+
+//==============================================================================
+// Identifies the font builder which will rasterise the atlas (builders differ in glyph metrics and pixels)
+// Note: Function pointers aren't stable between runs (ASLR), so builders are identified by kind
+static juce::uint32 ImGui_ImplJuce_GetFontBuilderID
+(
+    ImFontAtlas const& i_fontAtlas
+)
+{
+    enum FontBuilderID : juce::uint32
+    {
+        FontBuilderID_StbTruetype = 1,
+        FontBuilderID_FreeType = 2,         // Default builder with IMGUI_ENABLE_FREETYPE
+        FontBuilderID_Custom = 3            // Any io.Fonts->FontBuilderIO set by the user (incl. ImGuiFreeType::GetBuilderForFreeType())
+    };
+
+    if(i_fontAtlas.FontBuilderIO == nullptr)
+    {
+#ifdef IMGUI_ENABLE_FREETYPE
+        return FontBuilderID_FreeType;
+#else
+        return FontBuilderID_StbTruetype;
+#endif
+    }
+
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    if(i_fontAtlas.FontBuilderIO == ImFontAtlasGetBuilderForStbTruetype())
+    {
+        return FontBuilderID_StbTruetype;
+    }
+#endif
+
+    return FontBuilderID_Custom;
+}
+
+//==============================================================================
+ImGui_Juce_FontAtlasCache::ImGui_Juce_FontAtlasCache
+(
+    juce::File const& i_cacheDirectory
+)   : m_cacheDirectory(i_cacheDirectory)
+{
+}
+
+//==============================================================================
+ImGui_Juce_FontAtlasCache::~ImGui_Juce_FontAtlasCache() = default;
+
+//==============================================================================
+juce::File ImGui_Juce_FontAtlasCache::GetDefaultCacheDirectory
+(
+    juce::String const& i_applicationName
+)
+{
+#if JUCE_MAC || JUCE_IOS
+    juce::File const cacheRoot = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory).getChildFile("Caches");
+#elif JUCE_LINUX || JUCE_BSD
+    juce::File const cacheRoot = juce::File::getSpecialLocation(juce::File::userHomeDirectory).getChildFile(".cache");
+#elif JUCE_WINDOWS
+    // Note: Local rather than roaming AppData, so the cache isn't synced between machines
+    juce::File const cacheRoot = juce::File::getSpecialLocation(juce::File::windowsLocalAppData);
+#else
+    juce::File const cacheRoot = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory);
+#endif
+
+    return cacheRoot.getChildFile(i_applicationName).getChildFile("ImGuiFontAtlas");
+}
+
+//==============================================================================
+ImGui_Juce_FontAtlasCache::LoadResult ImGui_Juce_FontAtlasCache::LoadOrBuild
+(
+    ImFontAtlas& io_fontAtlas
+    , float const i_renderingScale
+)
+{
+    // Cannot modify a locked atlas (i.e. between ImGui::NewFrame() and ImGui::EndFrame())
+    jassert(!io_fontAtlas.Locked);
+
+    juce::uint64 const key = ComputeKey(io_fontAtlas, i_renderingScale);
+    juce::File const cacheFile = GetCacheFile(key);
+
+    if(cacheFile.existsAsFile() && Load(cacheFile, key, io_fontAtlas))
+    {
+        return LoadResult::LoadedFromCache;
+    }
+
+    if(!io_fontAtlas.Build())
+    {
+        return LoadResult::BuildFailed;
+    }
+
+    return Write(cacheFile, key, io_fontAtlas) ? LoadResult::BuiltAndCached : LoadResult::BuiltNotCached;
+}
+
+//==============================================================================
+void ImGui_Juce_FontAtlasCache::ClearCache()
+{
+    for(juce::File const& cacheFile : m_cacheDirectory.findChildFiles(juce::File::findFiles, false, juce::String("*") + JuceImGuiFontAtlasCache::s_fileExtension))
+    {
+        cacheFile.deleteFile();
+    }
+}
+
+//==============================================================================
+juce::uint64 ImGui_Juce_FontAtlasCache::ComputeKey
+(
+    ImFontAtlas const& i_fontAtlas
+    , float const i_renderingScale
+) const
+{
+    JuceImGuiFontAtlasCache::KeyHasher keyHasher;
+
+    keyHasher.Add(static_cast<juce::int32>(IMGUI_VERSION_NUM));
+    keyHasher.Add(static_cast<juce::uint32>(sizeof(ImFontGlyph)));
+    keyHasher.Add(static_cast<juce::uint32>(sizeof(ImFontAtlasCustomRect)));
+    keyHasher.Add(i_renderingScale);
+    keyHasher.Add(ImGui_ImplJuce_GetFontBuilderID(i_fontAtlas));
+
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.Flags));
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.TexDesiredWidth));
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.TexGlyphPadding));
+    keyHasher.Add(static_cast<juce::uint32>(i_fontAtlas.FontBuilderFlags));
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.Fonts.Size));
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.ConfigData.Size));
+
+    for(ImFontConfig const& fontConfig : i_fontAtlas.ConfigData)
+    {
+        keyHasher.Add(static_cast<juce::int32>(fontConfig.FontDataSize));
+        keyHasher.Add(fontConfig.FontData, static_cast<size_t>(fontConfig.FontDataSize));
+        keyHasher.Add(static_cast<juce::int32>(fontConfig.FontNo));
+        keyHasher.Add(fontConfig.SizePixels);
+        keyHasher.Add(static_cast<juce::int32>(fontConfig.OversampleH));
+        keyHasher.Add(static_cast<juce::int32>(fontConfig.OversampleV));
+        keyHasher.Add(fontConfig.PixelSnapH);
+        keyHasher.Add(fontConfig.GlyphExtraSpacing.x);
+        keyHasher.Add(fontConfig.GlyphExtraSpacing.y);
+        keyHasher.Add(fontConfig.GlyphOffset.x);
+        keyHasher.Add(fontConfig.GlyphOffset.y);
+        keyHasher.Add(fontConfig.GlyphMinAdvanceX);
+        keyHasher.Add(fontConfig.GlyphMaxAdvanceX);
+        keyHasher.Add(fontConfig.MergeMode);
+        keyHasher.Add(static_cast<juce::uint32>(fontConfig.FontBuilderFlags));
+        keyHasher.Add(fontConfig.RasterizerMultiply);
+        keyHasher.Add(fontConfig.RasterizerDensity);
+        keyHasher.Add(static_cast<juce::uint32>(fontConfig.EllipsisChar));
+        keyHasher.Add(static_cast<juce::int32>(ImGui_ImplJuce_FindFontIndex(i_fontAtlas, fontConfig.DstFont)));
+
+        // Glyph ranges: zero terminated list of [first, last] pairs
+        for(ImWchar const* glyphRange = fontConfig.GlyphRanges; glyphRange != nullptr && *glyphRange != 0; glyphRange++)
+        {
+            keyHasher.Add(static_cast<juce::uint32>(*glyphRange));
+        }
+        keyHasher.Add(static_cast<juce::uint32>(0));
+    }
+
+    // User custom rects (added before building) take part in packing
+    keyHasher.Add(static_cast<juce::int32>(i_fontAtlas.CustomRects.Size));
+
+    for(ImFontAtlasCustomRect const& customRect : i_fontAtlas.CustomRects)
+    {
+        keyHasher.Add(static_cast<juce::uint32>(customRect.Width));
+        keyHasher.Add(static_cast<juce::uint32>(customRect.Height));
+        keyHasher.Add(static_cast<juce::uint32>(customRect.GlyphID));
+        keyHasher.Add(customRect.GlyphAdvanceX);
+        keyHasher.Add(customRect.GlyphOffset.x);
+        keyHasher.Add(customRect.GlyphOffset.y);
+        keyHasher.Add(static_cast<juce::int32>(ImGui_ImplJuce_FindFontIndex(i_fontAtlas, customRect.Font)));
+    }
+
+    return keyHasher.GetHash();
+}
+
+//==============================================================================
+juce::File ImGui_Juce_FontAtlasCache::GetCacheFile
+(
+    juce::uint64 const i_key
+) const
+{
+    return m_cacheDirectory.getChildFile(juce::String::toHexString(static_cast<juce::int64>(i_key)).paddedLeft('0', 16) + JuceImGuiFontAtlasCache::s_fileExtension);
+}
+
+//==============================================================================
+bool ImGui_Juce_FontAtlasCache::Load
+(
+    juce::File const& i_cacheFile
+    , juce::uint64 const i_key
+    , ImFontAtlas& io_fontAtlas
+) const
+{
+    juce::MemoryMappedFile const memoryMappedFile(i_cacheFile, juce::MemoryMappedFile::readOnly);
+
+    if(memoryMappedFile.getData() == nullptr)
+    {
+        return false;
+    }
+
+    JuceImGuiFontAtlasCache::MemoryReader memoryReader(memoryMappedFile.getData(), memoryMappedFile.getSize());
+
+    //==============================================================================
+    // Validate the whole file before touching the atlas, so a corrupt / stale cache falls back to a clean rebuild
+    JuceImGuiFontAtlasCache::FileHeader fileHeader {};
+
+    if(!memoryReader.Read(&fileHeader, sizeof(fileHeader))
+        || std::memcmp(fileHeader.m_magic, JuceImGuiFontAtlasCache::s_fileMagic, sizeof(fileHeader.m_magic)) != 0
+        || fileHeader.m_version != JuceImGuiFontAtlasCache::s_fileVersion
+        || fileHeader.m_imguiVersionNum != static_cast<juce::uint32>(IMGUI_VERSION_NUM)
+        || fileHeader.m_key != i_key
+        || fileHeader.m_sizeOfFontGlyph != sizeof(ImFontGlyph)
+        || fileHeader.m_sizeOfCustomRect != sizeof(ImFontAtlasCustomRect)
+        || fileHeader.m_numFonts != io_fontAtlas.Fonts.Size
+        || fileHeader.m_numCustomRects < io_fontAtlas.CustomRects.Size
+        || fileHeader.m_texWidth <= 0 || fileHeader.m_texWidth > JuceImGuiFontAtlasCache::s_maxTextureSize
+        || fileHeader.m_texHeight <= 0 || fileHeader.m_texHeight > JuceImGuiFontAtlasCache::s_maxTextureSize)
+    {
+        return false;
+    }
+
+    std::vector<JuceImGuiFontAtlasCache::FontRecord> fontRecords(static_cast<size_t>(fileHeader.m_numFonts));
+    std::vector<void const*> fontGlyphs(static_cast<size_t>(fileHeader.m_numFonts));
+
+    for(size_t fontIndex = 0; fontIndex < fontRecords.size(); fontIndex++)
+    {
+        JuceImGuiFontAtlasCache::FontRecord& fontRecord = fontRecords[fontIndex];
+
+        if(!memoryReader.Read(&fontRecord, sizeof(fontRecord)) || fontRecord.m_numGlyphs < 0)
+        {
+            return false;
+        }
+
+        fontGlyphs[fontIndex] = memoryReader.Skip(static_cast<size_t>(fontRecord.m_numGlyphs) * sizeof(ImFontGlyph));
+
+        if(fontGlyphs[fontIndex] == nullptr)
+        {
+            return false;
+        }
+    }
+
+    std::vector<JuceImGuiFontAtlasCache::CustomRectRecord> customRectRecords(static_cast<size_t>(fileHeader.m_numCustomRects));
+    std::vector<ImFontAtlasCustomRect> customRects(static_cast<size_t>(fileHeader.m_numCustomRects));
+
+    for(size_t customRectIndex = 0; customRectIndex < customRects.size(); customRectIndex++)
+    {
+        JuceImGuiFontAtlasCache::CustomRectRecord& customRectRecord = customRectRecords[customRectIndex];
+
+        if(!memoryReader.Read(&customRectRecord, sizeof(customRectRecord))
+            || !memoryReader.Read(&customRects[customRectIndex], sizeof(ImFontAtlasCustomRect))
+            || customRectRecord.m_fontIndex < -1 || customRectRecord.m_fontIndex >= fileHeader.m_numFonts)
+        {
+            return false;
+        }
+    }
+
+    size_t const numPixels = static_cast<size_t>(fileHeader.m_texWidth) * static_cast<size_t>(fileHeader.m_texHeight);
+    void const* const pixels = memoryReader.Skip(numPixels);
+
+    if(pixels == nullptr)
+    {
+        return false;
+    }
+
+    //==============================================================================
+    // Apply: equivalent to the state ImFontAtlas::Build() leaves behind (See: ImFontAtlasBuildSetupFont(), ImFontAtlasBuildFinish())
+    io_fontAtlas.ClearTexData();
+
+    io_fontAtlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(numPixels));
+    std::memcpy(io_fontAtlas.TexPixelsAlpha8, pixels, numPixels);
+    io_fontAtlas.TexWidth = fileHeader.m_texWidth;
+    io_fontAtlas.TexHeight = fileHeader.m_texHeight;
+    io_fontAtlas.TexUvScale = ImVec2(fileHeader.m_texUvScale[0], fileHeader.m_texUvScale[1]);
+    io_fontAtlas.TexUvWhitePixel = ImVec2(fileHeader.m_texUvWhitePixel[0], fileHeader.m_texUvWhitePixel[1]);
+    std::memcpy(io_fontAtlas.TexUvLines, fileHeader.m_texUvLines, sizeof(io_fontAtlas.TexUvLines));
+    io_fontAtlas.PackIdMouseCursor = fileHeader.m_packIdMouseCursor;
+    io_fontAtlas.PackIdLines = fileHeader.m_packIdLines;
+
+    // Note: Includes the built-in rects (mouse cursors, lines) appended by the build, with their packed positions
+    io_fontAtlas.CustomRects.resize(fileHeader.m_numCustomRects);
+    for(size_t customRectIndex = 0; customRectIndex < customRects.size(); customRectIndex++)
+    {
+        int const fontIndex = customRectRecords[customRectIndex].m_fontIndex;
+
+        io_fontAtlas.CustomRects[static_cast<int>(customRectIndex)] = customRects[customRectIndex];
+        io_fontAtlas.CustomRects[static_cast<int>(customRectIndex)].Font = fontIndex >= 0 ? io_fontAtlas.Fonts[fontIndex] : nullptr;
+    }
+
+    for(ImFont* const font : io_fontAtlas.Fonts)
+    {
+        font->ClearOutputData();
+        font->ConfigData = nullptr;
+        font->ConfigDataCount = 0;
+    }
+
+    for(ImFontConfig& fontConfig : io_fontAtlas.ConfigData)
+    {
+        ImFont* const font = fontConfig.DstFont;
+
+        if(!fontConfig.MergeMode)
+        {
+            font->ConfigData = &fontConfig;
+            font->ContainerAtlas = &io_fontAtlas;
+        }
+
+        font->ConfigDataCount++;
+    }
+
+    for(int fontIndex = 0; fontIndex < io_fontAtlas.Fonts.Size; fontIndex++)
+    {
+        ImFont* const font = io_fontAtlas.Fonts[fontIndex];
+        JuceImGuiFontAtlasCache::FontRecord const& fontRecord = fontRecords[static_cast<size_t>(fontIndex)];
+
+        font->FontSize = fontRecord.m_fontSize;
+        font->Ascent = fontRecord.m_ascent;
+        font->Descent = fontRecord.m_descent;
+        font->MetricsTotalSurface = fontRecord.m_metricsTotalSurface;
+
+        font->Glyphs.resize(fontRecord.m_numGlyphs);
+        if(fontRecord.m_numGlyphs > 0)
+        {
+            std::memcpy(font->Glyphs.Data, fontGlyphs[static_cast<size_t>(fontIndex)], static_cast<size_t>(fontRecord.m_numGlyphs) * sizeof(ImFontGlyph));
+        }
+
+        font->BuildLookupTable();
+    }
+
+    io_fontAtlas.TexReady = true;
+    return true;
+}
+
+//==============================================================================
+bool ImGui_Juce_FontAtlasCache::Write
+(
+    juce::File const& i_cacheFile
+    , juce::uint64 const i_key
+    , ImFontAtlas const& i_fontAtlas
+) const
+{
+    // Colour atlases (RGBA32 only) aren't supported
+    if(i_fontAtlas.TexPixelsAlpha8 == nullptr || i_fontAtlas.TexPixelsUseColors)
+    {
+        return false;
+    }
+
+    juce::MemoryOutputStream memoryOutputStream;
+
+    JuceImGuiFontAtlasCache::FileHeader fileHeader {};
+    std::memcpy(fileHeader.m_magic, JuceImGuiFontAtlasCache::s_fileMagic, sizeof(fileHeader.m_magic));
+    fileHeader.m_version = JuceImGuiFontAtlasCache::s_fileVersion;
+    fileHeader.m_imguiVersionNum = static_cast<juce::uint32>(IMGUI_VERSION_NUM);
+    fileHeader.m_key = i_key;
+    fileHeader.m_sizeOfFontGlyph = sizeof(ImFontGlyph);
+    fileHeader.m_sizeOfCustomRect = sizeof(ImFontAtlasCustomRect);
+    fileHeader.m_texWidth = i_fontAtlas.TexWidth;
+    fileHeader.m_texHeight = i_fontAtlas.TexHeight;
+    fileHeader.m_texUvScale[0] = i_fontAtlas.TexUvScale.x;
+    fileHeader.m_texUvScale[1] = i_fontAtlas.TexUvScale.y;
+    fileHeader.m_texUvWhitePixel[0] = i_fontAtlas.TexUvWhitePixel.x;
+    fileHeader.m_texUvWhitePixel[1] = i_fontAtlas.TexUvWhitePixel.y;
+    std::memcpy(fileHeader.m_texUvLines, i_fontAtlas.TexUvLines, sizeof(fileHeader.m_texUvLines));
+    fileHeader.m_numFonts = i_fontAtlas.Fonts.Size;
+    fileHeader.m_numCustomRects = i_fontAtlas.CustomRects.Size;
+    fileHeader.m_packIdMouseCursor = i_fontAtlas.PackIdMouseCursor;
+    fileHeader.m_packIdLines = i_fontAtlas.PackIdLines;
+    memoryOutputStream.write(&fileHeader, sizeof(fileHeader));
+
+    for(ImFont const* const font : i_fontAtlas.Fonts)
+    {
+        JuceImGuiFontAtlasCache::FontRecord fontRecord {};
+        fontRecord.m_fontSize = font->FontSize;
+        fontRecord.m_ascent = font->Ascent;
+        fontRecord.m_descent = font->Descent;
+        fontRecord.m_metricsTotalSurface = font->MetricsTotalSurface;
+        fontRecord.m_numGlyphs = font->Glyphs.Size;
+        memoryOutputStream.write(&fontRecord, sizeof(fontRecord));
+
+        if(font->Glyphs.Size > 0)
+        {
+            memoryOutputStream.write(font->Glyphs.Data, static_cast<size_t>(font->Glyphs.Size) * sizeof(ImFontGlyph));
+        }
+    }
+
+    for(ImFontAtlasCustomRect const& customRect : i_fontAtlas.CustomRects)
+    {
+        JuceImGuiFontAtlasCache::CustomRectRecord customRectRecord {};
+        customRectRecord.m_fontIndex = ImGui_ImplJuce_FindFontIndex(i_fontAtlas, customRect.Font);
+        memoryOutputStream.write(&customRectRecord, sizeof(customRectRecord));
+
+        // Note: The ImFont pointer is meaningless on disk, it's restored from m_fontIndex
+        ImFontAtlasCustomRect customRectCopy = customRect;
+        customRectCopy.Font = nullptr;
+        memoryOutputStream.write(&customRectCopy, sizeof(customRectCopy));
+    }
+
+    memoryOutputStream.write(i_fontAtlas.TexPixelsAlpha8, static_cast<size_t>(i_fontAtlas.TexWidth) * static_cast<size_t>(i_fontAtlas.TexHeight));
+
+    //==============================================================================
+    if(m_cacheDirectory.createDirectory().failed())
+    {
+        return false;
+    }
+
+    // Write to a temporary file and then move it into place, so concurrent editor opens (e.g. several plugin instances) never map a partial file
+    juce::TemporaryFile temporaryFile(i_cacheFile);
+
+    {
+        juce::FileOutputStream fileOutputStream(temporaryFile.getFile());
+
+        if(fileOutputStream.failedToOpen()
+            || !fileOutputStream.write(memoryOutputStream.getData(), memoryOutputStream.getDataSize()))
+        {
+            return false;
+        }
+
+        fileOutputStream.flush();
+
+        if(fileOutputStream.getStatus().failed())
+        {
+            return false;
+        }
+    }
+
+    return temporaryFile.overwriteTargetFileWithTemporary();
+}
+
+#endif // #ifndef IMGUI_DISABLE
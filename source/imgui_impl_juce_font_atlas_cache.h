@@ -0,0 +1,81 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: On-disk font atlas cache for the Juce Platform Backend
+// Caches the built ImFontAtlas (alpha8 pixels, glyphs, metrics, custom rects) in the user's cache directory
+// Later editor opens load the atlas from a memory-mapped file, without rasterising any glyphs
+
+// The cache key covers: the font data (hash), each ImFontConfig (size, oversampling, glyph ranges, merge mode...)
+// The atlas flags / custom rects, the font builder (stb_truetype / FreeType), the rendering scale and IMGUI_VERSION_NUM
+// Any mismatch falls back to a rebuild. Note: Custom io.Fonts->FontBuilderIO builders share one key, so ClearCache() when changing them
+
+// Usage (after adding fonts to io.Fonts, before the renderer creates the font texture e.g. before the first frame):
+//  m_fontAtlasCache = std::make_unique<ImGui_Juce_FontAtlasCache>(ImGui_Juce_FontAtlasCache::GetDefaultCacheDirectory("MyPlugin"));
+//  io.Fonts->AddFontFromMemoryTTF(...); // with font sizes scaled by the rendering scale
+//  m_fontAtlasCache->LoadOrBuild(*io.Fonts, renderingScale);
+// The renderer then finds the atlas already built (ImFontAtlas::IsBuilt()), e.g. ImGui_ImplOpenGL3_CreateFontsTexture()
+
+// Note: Not applicable to ImGui 1.92+, which rasterises glyphs on demand (dynamic font atlas)
+// Note: Atlases built with colour glyphs (e.g. FreeType ImGuiFreeTypeBuilderFlags_LoadColor) aren't cached
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#if IMGUI_VERSION_NUM >= 19200
+#error "imgui_impl_juce_font_atlas_cache: ImGui 1.92+ builds font glyphs dynamically, so a built atlas cache doesn't apply"
+#endif
+
+#include <juce_core/juce_core.h>
+
+//==============================================================================
+class ImGui_Juce_FontAtlasCache
+{
+public:
+    enum class LoadResult
+    {
+        LoadedFromCache,    // No rasterisation
+        BuiltAndCached,     // Cache miss, the atlas was built and written to the cache
+        BuiltNotCached,     // Cache miss, the atlas was built but couldn't be cached (e.g. colour atlas, unwritable directory)
+        BuildFailed
+    };
+
+    explicit ImGui_Juce_FontAtlasCache(juce::File const& i_cacheDirectory);
+    ~ImGui_Juce_FontAtlasCache();
+    ImGui_Juce_FontAtlasCache(ImGui_Juce_FontAtlasCache const&) = delete;
+
+    ImGui_Juce_FontAtlasCache& operator=(ImGui_Juce_FontAtlasCache const&) = delete;
+    bool operator==(ImGui_Juce_FontAtlasCache const&) = delete;
+    bool operator!=(ImGui_Juce_FontAtlasCache const&) = delete;
+
+    //==============================================================================
+    // Platform cache directory, e.g. ~/Library/Caches/<Application Name>/ImGuiFontAtlas on MacOS
+    static juce::File GetDefaultCacheDirectory(juce::String const& i_applicationName);
+
+    //==============================================================================
+    // Loads io_fontAtlas from the cache if its key matches, otherwise builds it (ImFontAtlas::Build()) and writes the cache
+    // i_renderingScale: the scale the font sizes were multiplied by, so each display scale has its own cache entry
+    // Note: Requires a current ImGuiContext
+    LoadResult LoadOrBuild(ImFontAtlas& io_fontAtlas, float i_renderingScale);
+
+    // Deletes all cached atlases in the cache directory
+    void ClearCache();
+
+private:
+    //==============================================================================
+    juce::uint64 ComputeKey(ImFontAtlas const& i_fontAtlas, float i_renderingScale) const;
+    juce::File GetCacheFile(juce::uint64 i_key) const;
+
+    bool Load(juce::File const& i_cacheFile, juce::uint64 i_key, ImFontAtlas& io_fontAtlas) const;
+    bool Write(juce::File const& i_cacheFile, juce::uint64 i_key, ImFontAtlas const& i_fontAtlas) const;
+
+    //==============================================================================
+    // Constructor initialisation order:
+    juce::File m_cacheDirectory;
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,223 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Mouse cursor registry for the Juce Platform Backend
+// See imgui_impl_juce_mouse_cursor.h
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_mouse_cursor.h"
+
+//==============================================================================
+static constexpr juce::MouseCursor::StandardCursorType ImGui_ImplJuce_ImGuiMouseCursor_ToJuceStandardCursorType
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+)
+{
+    switch(i_imGuiMouseCursor)
+    {
+        case ImGuiMouseCursor_None: return juce::MouseCursor::StandardCursorType::NoCursor;
+        case ImGuiMouseCursor_Arrow: return juce::MouseCursor::StandardCursorType::NormalCursor;
+        case ImGuiMouseCursor_TextInput: return juce::MouseCursor::StandardCursorType::IBeamCursor;
+        case ImGuiMouseCursor_ResizeAll: return juce::MouseCursor::StandardCursorType::UpDownLeftRightResizeCursor;
+        case ImGuiMouseCursor_ResizeNS: return juce::MouseCursor::StandardCursorType::UpDownResizeCursor;
+        case ImGuiMouseCursor_ResizeEW: return juce::MouseCursor::StandardCursorType::LeftRightResizeCursor;
+        case ImGuiMouseCursor_ResizeNESW: return juce::MouseCursor::StandardCursorType::BottomLeftCornerResizeCursor;
+        case ImGuiMouseCursor_ResizeNWSE: return juce::MouseCursor::StandardCursorType::BottomRightCornerResizeCursor;
+        case ImGuiMouseCursor_Hand: return juce::MouseCursor::StandardCursorType::PointingHandCursor;
+
+        /**
+         * Note: ImGui doesn't natively support the following Juce cursor types
+         * Extend ImGuiMouseCursor_ within imgui.h wrapped with this define to support these:
+        * */
+#if Juce_ImGuiMouseCursor_Extensions
+        case ImGuiMouseCursor_ParentCursor: return juce::MouseCursor::StandardCursorType::ParentCursor;
+        case ImGuiMouseCursor_WaitCursor: return juce::MouseCursor::StandardCursorType::WaitCursor;
+        case ImGuiMouseCursor_CrosshairCursor: return juce::MouseCursor::StandardCursorType::CrosshairCursor;
+        case ImGuiMouseCursor_CopyingCursor: return juce::MouseCursor::StandardCursorType::CopyingCursor;
+        case ImGuiMouseCursor_DraggingHandCursor: return juce::MouseCursor::StandardCursorType::DraggingHandCursor;
+        case ImGuiMouseCursor_TopEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::TopEdgeResizeCursor;
+        case ImGuiMouseCursor_BottomEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::BottomEdgeResizeCursor;
+        case ImGuiMouseCursor_LeftEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::LeftEdgeResizeCursor;
+        case ImGuiMouseCursor_RightEdgeResizeCursor: return juce::MouseCursor::StandardCursorType::RightEdgeResizeCursor;
+        case ImGuiMouseCursor_TopLeftCornerResizeCursor: return juce::MouseCursor::StandardCursorType::TopLeftCornerResizeCursor;
+        case ImGuiMouseCursor_TopRightCornerResizeCursor: return juce::MouseCursor::StandardCursorType::TopRightCornerResizeCursor;
+#endif
+
+        default: return juce::MouseCursor::StandardCursorType::NormalCursor;
+    }
+
+    /**
+     * Juce doesn't currently support:
+     * ImGuiMouseCursor_NotAllowed (Provided as a custom image cursor, See: ImGui_ImplJuce_CreateNotAllowedCursorImage())
+     * */
+}
+
+//==============================================================================
+static juce::Image ImGui_ImplJuce_CreateNotAllowedCursorImage
+(
+    float const i_renderingScale
+    , juce::Point<int>& o_hotSpot
+)
+{
+    // A crossed circle, outlined for contrast against both light and dark backgrounds
+    static constexpr float s_cursorSize = 16.0f;
+
+    int const imageSize = juce::roundToInt(s_cursorSize * i_renderingScale);
+    juce::Image image(juce::Image::ARGB, imageSize, imageSize, true);
+
+    {
+        juce::Graphics graphics(image);
+        graphics.addTransform(juce::AffineTransform::scale(i_renderingScale));
+
+        juce::Rectangle<float> const circleBounds = juce::Rectangle<float>(s_cursorSize, s_cursorSize).reduced(2.5f);
+        float const diagonalOffset = circleBounds.getWidth() * 0.5f * juce::MathConstants<float>::sqrt2 * 0.5f;
+        juce::Point<float> const centre = circleBounds.getCentre();
+        juce::Line<float> const slash(centre.translated(-diagonalOffset, -diagonalOffset), centre.translated(diagonalOffset, diagonalOffset));
+
+        graphics.setColour(juce::Colours::white);
+        graphics.drawEllipse(circleBounds, 3.5f);
+        graphics.drawLine(slash, 3.5f);
+
+        graphics.setColour(juce::Colours::black);
+        graphics.drawEllipse(circleBounds, 1.5f);
+        graphics.drawLine(slash, 1.5f);
+    }
+
+    o_hotSpot = juce::Point<int>(imageSize / 2, imageSize / 2);
+    return image;
+}
+
+//==============================================================================
+ImGui_Juce_MouseCursorRegistry::ImGui_Juce_MouseCursorRegistry()
+{
+    RegisterCustomMouseCursor(ImGuiMouseCursor_NotAllowed, ImGui_ImplJuce_CreateNotAllowedCursorImage);
+}
+
+//==============================================================================
+void ImGui_Juce_MouseCursorRegistry::RegisterCustomMouseCursor
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+    , CustomMouseCursorImageFunction i_customMouseCursorImageFunction
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    jassert(i_imGuiMouseCursor != ImGuiMouseCursor_None); // ImGuiMouseCursor_None always hides the cursor
+    jassert(i_customMouseCursorImageFunction);
+
+    UnregisterCustomMouseCursor(i_imGuiMouseCursor);
+    m_customMouseCursors.push_back({ i_imGuiMouseCursor, std::move(i_customMouseCursorImageFunction) });
+}
+
+//==============================================================================
+void ImGui_Juce_MouseCursorRegistry::UnregisterCustomMouseCursor
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    auto const isMatchingCursor = [i_imGuiMouseCursor](CustomMouseCursor const& i_customMouseCursor)
+    {
+        return i_customMouseCursor.m_imGuiMouseCursor == i_imGuiMouseCursor;
+    };
+
+    m_customMouseCursors.erase(std::remove_if(m_customMouseCursors.begin(), m_customMouseCursors.end(), isMatchingCursor)
+                            , m_customMouseCursors.end());
+
+    RemoveCachedMouseCursors(i_imGuiMouseCursor);
+}
+
+//==============================================================================
+juce::MouseCursor const& ImGui_Juce_MouseCursorRegistry::GetMouseCursor
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+    , float const i_renderingScale
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    CustomMouseCursor const* const customMouseCursor = FindCustomMouseCursor(i_imGuiMouseCursor);
+
+    // Standard cursors are scale independent (the native cursor handles scaling), so are cached once per ID
+    float const cacheRenderingScale = (customMouseCursor != nullptr) ? i_renderingScale : 0.0f;
+
+    for(CachedMouseCursor const& cachedMouseCursor : m_cachedMouseCursors)
+    {
+        if(cachedMouseCursor.m_imGuiMouseCursor == i_imGuiMouseCursor && cachedMouseCursor.m_renderingScale == cacheRenderingScale)
+        {
+            return cachedMouseCursor.m_mouseCursor;
+        }
+    }
+
+    // Cache miss: build the juce::MouseCursor (Only occurs once per ID and rendering scale)
+    if(customMouseCursor == nullptr)
+    {
+        m_cachedMouseCursors.push_back({ i_imGuiMouseCursor, cacheRenderingScale
+                                        , juce::MouseCursor(ImGui_ImplJuce_ImGuiMouseCursor_ToJuceStandardCursorType(i_imGuiMouseCursor)) });
+
+        return m_cachedMouseCursors.back().m_mouseCursor;
+    }
+
+    juce::Point<int> hotSpot;
+    juce::Image const image = customMouseCursor->m_imageFunction(i_renderingScale, hotSpot);
+
+    if(!image.isValid())
+    {
+        jassertfalse; // custom cursor image function failed, fall back to the standard mapping
+        m_cachedMouseCursors.push_back({ i_imGuiMouseCursor, cacheRenderingScale, juce::MouseCursor(juce::MouseCursor::StandardCursorType::NormalCursor) });
+        return m_cachedMouseCursors.back().m_mouseCursor;
+    }
+
+    m_cachedMouseCursors.push_back({ i_imGuiMouseCursor, cacheRenderingScale
+                                    , juce::MouseCursor(juce::ScaledImage(image, static_cast<double>(i_renderingScale)), hotSpot) });
+
+    return m_cachedMouseCursors.back().m_mouseCursor;
+}
+
+//==============================================================================
+void ImGui_Juce_MouseCursorRegistry::ClearCache()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    m_cachedMouseCursors.clear();
+}
+
+//==============================================================================
+ImGui_Juce_MouseCursorRegistry::CustomMouseCursor const* ImGui_Juce_MouseCursorRegistry::FindCustomMouseCursor
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+) const
+{
+    for(CustomMouseCursor const& customMouseCursor : m_customMouseCursors)
+    {
+        if(customMouseCursor.m_imGuiMouseCursor == i_imGuiMouseCursor)
+        {
+            return &customMouseCursor;
+        }
+    }
+
+    return nullptr;
+}
+
+//==============================================================================
+void ImGui_Juce_MouseCursorRegistry::RemoveCachedMouseCursors
+(
+    ImGuiMouseCursor const i_imGuiMouseCursor
+)
+{
+    auto const isMatchingCursor = [i_imGuiMouseCursor](CachedMouseCursor const& i_cachedMouseCursor)
+    {
+        return i_cachedMouseCursor.m_imGuiMouseCursor == i_imGuiMouseCursor;
+    };
+
+    m_cachedMouseCursors.erase(std::remove_if(m_cachedMouseCursors.begin(), m_cachedMouseCursors.end(), isMatchingCursor)
+                            , m_cachedMouseCursors.end());
+}
+
+#endif // #ifndef IMGUI_DISABLE
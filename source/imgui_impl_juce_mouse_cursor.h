@@ -0,0 +1,86 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Mouse cursor registry for the Juce Platform Backend
+// Owned by ImGui_Juce_Backend (See: ImGui_Juce_Backend::GetMouseCursorRegistry())
+// Builds juce::MouseCursor objects once per ImGuiMouseCursor ID and rendering scale, then reuses them
+// So rapid cursor changes (e.g. hovering dense widget grids) never allocate or re-create native cursor handles
+
+// Supports custom image cursors for:
+// - ImGuiMouseCursor IDs without a Juce standard cursor equivalent (e.g. ImGuiMouseCursor_NotAllowed, provided by default)
+// - App specific cursor IDs (>= ImGuiMouseCursor_COUNT), set with ImGui::SetMouseCursor()
+// - Overriding any standard cursor
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+//==============================================================================
+class ImGui_Juce_MouseCursorRegistry
+{
+public:
+    // Returns the cursor image for the given rendering scale, and its hotspot within the image (in image pixels)
+    // The image should be drawn at the rendering scale (e.g. 32x32 pixels for a 16x16 cursor at scale 2.0)
+    using CustomMouseCursorImageFunction = std::function<juce::Image(float i_renderingScale, juce::Point<int>& o_hotSpot)>;
+
+    ImGui_Juce_MouseCursorRegistry();
+    ~ImGui_Juce_MouseCursorRegistry() = default;
+    ImGui_Juce_MouseCursorRegistry(ImGui_Juce_MouseCursorRegistry const&) = delete;
+
+    ImGui_Juce_MouseCursorRegistry& operator=(ImGui_Juce_MouseCursorRegistry const&) = delete;
+    bool operator==(ImGui_Juce_MouseCursorRegistry const&) = delete;
+    bool operator!=(ImGui_Juce_MouseCursorRegistry const&) = delete;
+
+    //==============================================================================
+    // Register a custom image cursor for an ImGuiMouseCursor ID, replacing any previous registration / standard mapping
+    // Note: Must be called from the main thread (Juce message thread)
+    void RegisterCustomMouseCursor(ImGuiMouseCursor i_imGuiMouseCursor
+                        , CustomMouseCursorImageFunction i_customMouseCursorImageFunction);
+    void UnregisterCustomMouseCursor(ImGuiMouseCursor i_imGuiMouseCursor);
+
+    //==============================================================================
+    // Returns the cached juce::MouseCursor, building it on first use for this ID and rendering scale
+    // Note: Must be called from the main thread (Juce message thread)
+    juce::MouseCursor const& GetMouseCursor(ImGuiMouseCursor i_imGuiMouseCursor
+                        , float i_renderingScale);
+
+    //==============================================================================
+    // Releases all cached juce::MouseCursor objects (they are rebuilt on demand)
+    void ClearCache();
+
+private:
+    //==============================================================================
+    struct CustomMouseCursor
+    {
+        ImGuiMouseCursor m_imGuiMouseCursor;
+        CustomMouseCursorImageFunction m_imageFunction;
+    };
+
+    struct CachedMouseCursor
+    {
+        ImGuiMouseCursor m_imGuiMouseCursor;
+        float m_renderingScale; // 0.0f for scale independent (standard) cursors
+        juce::MouseCursor m_mouseCursor;
+    };
+
+    //==============================================================================
+    CustomMouseCursor const* FindCustomMouseCursor(ImGuiMouseCursor i_imGuiMouseCursor) const;
+    void RemoveCachedMouseCursors(ImGuiMouseCursor i_imGuiMouseCursor);
+
+    //==============================================================================
+    // Note: Few entries, so linear searches over contiguous storage (lookups never allocate)
+    std::vector<CustomMouseCursor> m_customMouseCursors;
+    std::vector<CachedMouseCursor> m_cachedMouseCursors;
+};
+
+#endif // #ifndef IMGUI_DISABLE
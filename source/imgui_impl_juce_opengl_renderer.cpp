@@ -0,0 +1,621 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Juce native OpenGL Renderer for the Juce Platform Backend
+// See imgui_impl_juce_opengl_renderer.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_opengl_renderer.h"
+
+#include <cstddef>
+#include <cstring>
+
+static constexpr char const* s_backendRendererName = "imgui_impl_juce_opengl_renderer";
+static constexpr juce::gl::GLuint s_invalidTextureID = ~0u;
+
+// Note: Written for GLSL 1.2, translated by Juce for GLSL 3 (Core profile) contexts
+static constexpr char const* s_vertexShader =
+    "attribute vec2 position;\n"
+    "attribute vec2 uv;\n"
+    "attribute vec4 colour;\n"
+    "uniform mat4 projectionMatrix;\n"
+    "varying vec2 fragUV;\n"
+    "varying vec4 fragColour;\n"
+    "void main()\n"
+    "{\n"
+    "    fragUV = uv;\n"
+    "    fragColour = colour;\n"
+    "    gl_Position = projectionMatrix * vec4(position.xy, 0.0, 1.0);\n"
+    "}\n";
+
+static constexpr char const* s_fragmentShader =
+    "varying " JUCE_MEDIUMP " vec2 fragUV;\n"
+    "varying " JUCE_LOWP " vec4 fragColour;\n"
+    "uniform sampler2D imguiTexture;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = fragColour * texture2D(imguiTexture, fragUV);\n"
+    "}\n";
+
+//==============================================================================
+ImGui_Juce_OpenGLRenderer::ImGui_Juce_OpenGLRenderer
+(
+    juce::OpenGLContext& i_openGLContext
+)   : m_openGLContext(i_openGLContext)
+{
+}
+
+//==============================================================================
+ImGui_Juce_OpenGLRenderer::~ImGui_Juce_OpenGLRenderer()
+{
+    // Shutdown() must be called on the render thread, while the openGL context is still active
+    jassert(m_shaderProgram == nullptr && m_vertexBuffer == 0 && m_indexBuffer == 0 && m_fontsTexture == 0);
+}
+
+//==============================================================================
+bool ImGui_Juce_OpenGLRenderer::Init()
+{
+    using namespace juce::gl;
+
+    jassert(juce::OpenGLHelpers::isContextActive());
+
+    m_shaderProgram = std::make_unique<juce::OpenGLShaderProgram>(m_openGLContext);
+
+    if(!m_shaderProgram->addVertexShader(juce::OpenGLHelpers::translateVertexShaderToV3(s_vertexShader))
+        || !m_shaderProgram->addFragmentShader(juce::OpenGLHelpers::translateFragmentShaderToV3(s_fragmentShader))
+        || !m_shaderProgram->link())
+    {
+        DBG("ImGui_Juce_OpenGLRenderer: " << m_shaderProgram->getLastError());
+        jassertfalse;
+
+        m_shaderProgram.reset();
+        return false;
+    }
+
+    m_projectionMatrixUniform = std::make_unique<juce::OpenGLShaderProgram::Uniform>(*m_shaderProgram, "projectionMatrix");
+    m_textureUniform = std::make_unique<juce::OpenGLShaderProgram::Uniform>(*m_shaderProgram, "imguiTexture");
+    m_positionAttribute = juce::OpenGLShaderProgram::Attribute(*m_shaderProgram, "position").attributeID;
+    m_uvAttribute = juce::OpenGLShaderProgram::Attribute(*m_shaderProgram, "uv").attributeID;
+    m_colourAttribute = juce::OpenGLShaderProgram::Attribute(*m_shaderProgram, "colour").attributeID;
+
+    // Note: Core profile contexts require a vertex array object, legacy contexts use the default
+    if(m_openGLContext.isCoreProfile())
+    {
+        glGenVertexArrays(1, &m_vertexArrayObject);
+    }
+
+    glGenBuffers(1, &m_vertexBuffer);
+    glGenBuffers(1, &m_indexBuffer);
+
+    // Note: The attribute layout and index buffer binding are vertex array object state, so are recorded once here
+    // Orphaning the buffers each frame keeps the same buffer objects, so the recorded state stays valid
+    if(m_vertexArrayObject != 0)
+    {
+        glBindVertexArray(m_vertexArrayObject);
+        SetupVertexAttributes();
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // The sampler uniform is program state, so is only set once
+    m_shaderProgram->use();
+    m_textureUniform->set(0);
+    glUseProgram(0);
+
+    InvalidateRenderState();
+    m_projectionValid = false;
+
+    CreateFontsTexture();
+
+    ImGuiIO& io = ImGui::GetIO();
+
+    if(io.BackendRendererName == nullptr)
+    {
+        io.BackendRendererName = s_backendRendererName;
+    }
+
+    // We rebase indices on the CPU, so large meshes (> 64k vertices with 16 bit ImDrawIdx) are supported
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::Shutdown()
+{
+    using namespace juce::gl;
+
+    DestroyFontsTexture();
+
+    if(m_indexBuffer != 0)
+    {
+        glDeleteBuffers(1, &m_indexBuffer);
+        m_indexBuffer = 0;
+    }
+
+    if(m_vertexBuffer != 0)
+    {
+        glDeleteBuffers(1, &m_vertexBuffer);
+        m_vertexBuffer = 0;
+    }
+
+    if(m_vertexArrayObject != 0)
+    {
+        glDeleteVertexArrays(1, &m_vertexArrayObject);
+        m_vertexArrayObject = 0;
+    }
+
+    m_vertexBufferCapacity = 0;
+    m_indexBufferCapacity = 0;
+
+    m_textureUniform.reset();
+    m_projectionMatrixUniform.reset();
+    m_shaderProgram.reset();
+
+    ImGuiIO& io = ImGui::GetIO();
+
+    if(io.BackendRendererName == s_backendRendererName)
+    {
+        io.BackendRendererName = nullptr;
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::RenderDrawData
+(
+    ImDrawData const& i_drawData
+)
+{
+    using namespace juce::gl;
+
+    int const framebufferWidth = static_cast<int>(i_drawData.DisplaySize.x * i_drawData.FramebufferScale.x);
+    int const framebufferHeight = static_cast<int>(i_drawData.DisplaySize.y * i_drawData.FramebufferScale.y);
+
+    if(m_shaderProgram == nullptr || framebufferWidth <= 0 || framebufferHeight <= 0)
+    {
+        return;
+    }
+
+    BuildDrawOps(i_drawData, framebufferWidth, framebufferHeight);
+
+    if(m_drawOps.empty())
+    {
+        return;
+    }
+
+    // Others may have changed GL state since our previous frame (e.g. Juce's component painting)
+    if(!m_exclusiveContext)
+    {
+        InvalidateRenderState();
+    }
+
+    UploadBuffers(i_drawData);
+    SetupRenderState(i_drawData, framebufferWidth, framebufferHeight);
+
+    for(DrawOp const& drawOp : m_drawOps)
+    {
+        if(drawOp.m_drawCmd != nullptr)
+        {
+            if(drawOp.m_drawCmd->UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                SetupRenderState(i_drawData, framebufferWidth, framebufferHeight);
+            }
+            else
+            {
+                drawOp.m_drawCmd->UserCallback(drawOp.m_drawList, drawOp.m_drawCmd);
+
+                // The callback may have changed any GL state, so the cached state is no longer reliable
+                InvalidateRenderState();
+                m_boundTextureID = s_invalidTextureID;
+                m_currentScissor[2] = -1;
+            }
+
+            continue;
+        }
+
+        if(drawOp.m_textureID != m_boundTextureID)
+        {
+            glBindTexture(GL_TEXTURE_2D, drawOp.m_textureID);
+            m_boundTextureID = drawOp.m_textureID;
+        }
+
+        if(std::memcmp(drawOp.m_scissor, m_currentScissor, sizeof(m_currentScissor)) != 0)
+        {
+            glScissor(drawOp.m_scissor[0], drawOp.m_scissor[1], drawOp.m_scissor[2], drawOp.m_scissor[3]);
+            std::memcpy(m_currentScissor, drawOp.m_scissor, sizeof(m_currentScissor));
+        }
+
+        glDrawElements(GL_TRIANGLES
+                    , static_cast<GLsizei>(drawOp.m_indexCount)
+                    , GL_UNSIGNED_INT
+                    , reinterpret_cast<void const*>(static_cast<intptr_t>(drawOp.m_firstIndex * sizeof(juce::uint32))));
+
+        m_lastFrameStatistics.m_numDrawCalls++;
+    }
+
+    // Leave state as Juce expects it for its own rendering (e.g. components painted over the openGL context)
+    // Note: Enabled attributes are vertex array object state, so only need disabling without one
+    glDisable(GL_SCISSOR_TEST);
+
+    if(m_vertexArrayObject != 0)
+    {
+        glBindVertexArray(0);
+    }
+    else
+    {
+        glDisableVertexAttribArray(m_positionAttribute);
+        glDisableVertexAttribArray(m_uvAttribute);
+        glDisableVertexAttribArray(m_colourAttribute);
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::CreateFontsTexture()
+{
+    using namespace juce::gl;
+
+    DestroyFontsTexture();
+
+    ImGuiIO& io = ImGui::GetIO();
+
+    unsigned char* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    glGenTextures(1, &m_fontsTexture);
+    glBindTexture(GL_TEXTURE_2D, m_fontsTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)m_fontsTexture);
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::DestroyFontsTexture()
+{
+    using namespace juce::gl;
+
+    if(m_fontsTexture == 0)
+    {
+        return;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+
+    if(io.Fonts->TexID == (ImTextureID)(intptr_t)m_fontsTexture)
+    {
+        io.Fonts->SetTexID(0);
+    }
+
+    glDeleteTextures(1, &m_fontsTexture);
+    m_fontsTexture = 0;
+}
+
+//==============================================================================
+ImTextureID ImGui_Juce_OpenGLRenderer::GetFontsTextureID() const
+{
+    return (ImTextureID)(intptr_t)m_fontsTexture;
+}
+
+//==============================================================================
+ImGui_Juce_OpenGLRenderer::Statistics ImGui_Juce_OpenGLRenderer::GetLastFrameStatistics() const
+{
+    return m_lastFrameStatistics;
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::SetExclusiveContext
+(
+    bool const i_exclusiveContext
+)
+{
+    m_exclusiveContext = i_exclusiveContext;
+    InvalidateRenderState();
+}
+
+//==============================================================================
+size_t ImGui_Juce_OpenGLRenderer::GetBufferMemoryBytes() const
+{
+    return m_vertexBufferCapacity
+        + m_indexBufferCapacity
+        + m_indices.capacity() * sizeof(juce::uint32)
+        + m_drawOps.capacity() * sizeof(DrawOp);
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::ReleaseBuffers()
+{
+    using namespace juce::gl;
+
+    // Note: Re-specifying with zero size releases the storage, keeping the buffer objects (and vertex array object bindings)
+    if(m_vertexBuffer != 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    if(m_indexBuffer != 0)
+    {
+        // Note: The element array buffer binding is vertex array object state, so bind ours first
+        if(m_vertexArrayObject != 0)
+        {
+            glBindVertexArray(m_vertexArrayObject);
+        }
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
+
+        if(m_vertexArrayObject != 0)
+        {
+            glBindVertexArray(0);
+        }
+        else
+        {
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
+    }
+
+    m_vertexBufferCapacity = 0;
+    m_indexBufferCapacity = 0;
+
+    std::vector<juce::uint32>().swap(m_indices);
+    std::vector<DrawOp>().swap(m_drawOps);
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::BuildDrawOps
+(
+    ImDrawData const& i_drawData
+    , [[maybe_unused]] int const i_framebufferWidth
+    , int const i_framebufferHeight
+)
+{
+    m_numVertices = 0;
+    m_indices.clear();
+    m_drawOps.clear();
+    m_lastFrameStatistics = {};
+
+    ImVec2 const clipOffset = i_drawData.DisplayPos;
+    ImVec2 const clipScale = i_drawData.FramebufferScale;
+
+    for(int drawListIndex = 0; drawListIndex < i_drawData.CmdListsCount; drawListIndex++)
+    {
+        ImDrawList const* const drawList = i_drawData.CmdLists[drawListIndex];
+        juce::uint32 const drawListVertexBase = static_cast<juce::uint32>(m_numVertices);
+
+        // Note: The draw list's vertices are uploaded at this base as they are (See: UploadBuffers())
+        m_numVertices += static_cast<size_t>(drawList->VtxBuffer.Size);
+
+        for(ImDrawCmd const& drawCmd : drawList->CmdBuffer)
+        {
+            if(drawCmd.UserCallback != nullptr)
+            {
+                m_drawOps.push_back({ drawList, &drawCmd, 0, {}, 0, 0 });
+                continue;
+            }
+
+            if(drawCmd.ElemCount == 0)
+            {
+                continue;
+            }
+
+            m_lastFrameStatistics.m_numDrawCmds++;
+
+            // Project the clip rect into framebuffer space, culling fully clipped commands
+            float const clipMinX = (drawCmd.ClipRect.x - clipOffset.x) * clipScale.x;
+            float const clipMinY = (drawCmd.ClipRect.y - clipOffset.y) * clipScale.y;
+            float const clipMaxX = (drawCmd.ClipRect.z - clipOffset.x) * clipScale.x;
+            float const clipMaxY = (drawCmd.ClipRect.w - clipOffset.y) * clipScale.y;
+
+            if(clipMaxX <= clipMinX || clipMaxY <= clipMinY)
+            {
+                continue;
+            }
+
+            // Note: glScissor() origin is bottom left
+            int const scissor[4] = { static_cast<int>(clipMinX)
+                                    , static_cast<int>(static_cast<float>(i_framebufferHeight) - clipMaxY)
+                                    , static_cast<int>(clipMaxX - clipMinX)
+                                    , static_cast<int>(clipMaxY - clipMinY) };
+
+            juce::gl::GLuint const textureID = (juce::gl::GLuint)(intptr_t)drawCmd.GetTexID();
+
+            // Rebase the command's indices into the frame's shared vertex buffer
+            juce::uint32 const firstIndex = static_cast<juce::uint32>(m_indices.size());
+            juce::uint32 const vertexBase = drawListVertexBase + drawCmd.VtxOffset;
+            ImDrawIdx const* const sourceIndices = drawList->IdxBuffer.Data + drawCmd.IdxOffset;
+
+            m_indices.resize(m_indices.size() + drawCmd.ElemCount);
+            juce::uint32* const destinationIndices = m_indices.data() + firstIndex;
+
+            for(unsigned int i = 0; i < drawCmd.ElemCount; i++)
+            {
+                destinationIndices[i] = vertexBase + sourceIndices[i];
+            }
+
+            // Merge with the previous draw (possibly from a previous draw list) when texture and clip rect match
+            // Indices are appended in draw order, so a mergeable previous draw is always contiguous
+            if(!m_drawOps.empty())
+            {
+                DrawOp& previousDrawOp = m_drawOps.back();
+
+                if(previousDrawOp.m_drawCmd == nullptr
+                    && previousDrawOp.m_textureID == textureID
+                    && std::memcmp(previousDrawOp.m_scissor, scissor, sizeof(scissor)) == 0)
+                {
+                    previousDrawOp.m_indexCount += drawCmd.ElemCount;
+                    continue;
+                }
+            }
+
+            DrawOp drawOp { nullptr, nullptr, textureID, {}, firstIndex, drawCmd.ElemCount };
+            std::memcpy(drawOp.m_scissor, scissor, sizeof(scissor));
+            m_drawOps.push_back(drawOp);
+        }
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::UploadBuffers
+(
+    ImDrawData const& i_drawData
+)
+{
+    using namespace juce::gl;
+
+    // Note: The element array buffer binding is vertex array object state, so bind ours first
+    if(m_vertexArrayObject != 0)
+    {
+        glBindVertexArray(m_vertexArrayObject);
+    }
+
+    auto const orphanBuffer = [](GLenum const i_target, size_t const i_bytes, size_t& io_capacity)
+    {
+        if(i_bytes > io_capacity)
+        {
+            io_capacity = i_bytes + i_bytes / 2; // headroom, so growing UIs don't reallocate every frame
+        }
+
+        // Orphan the previous frame's storage: the driver hands back fresh memory, rather than stalling until the GPU is done with it
+        glBufferData(i_target, static_cast<GLsizeiptr>(io_capacity), nullptr, GL_STREAM_DRAW);
+    };
+
+    // Each draw list's vertices are uploaded straight from its VtxBuffer, at the base its indices were rebased to (See: BuildDrawOps())
+    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+    orphanBuffer(GL_ARRAY_BUFFER, m_numVertices * sizeof(ImDrawVert), m_vertexBufferCapacity);
+
+    size_t vertexOffsetBytes = 0;
+    for(int drawListIndex = 0; drawListIndex < i_drawData.CmdListsCount; drawListIndex++)
+    {
+        ImDrawList const* const drawList = i_drawData.CmdLists[drawListIndex];
+        size_t const vertexBytes = static_cast<size_t>(drawList->VtxBuffer.Size) * sizeof(ImDrawVert);
+
+        if(vertexBytes > 0)
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(vertexOffsetBytes), static_cast<GLsizeiptr>(vertexBytes), drawList->VtxBuffer.Data);
+            vertexOffsetBytes += vertexBytes;
+        }
+    }
+
+    // Indices were rebased on the CPU, so are a single upload for all draw lists
+    size_t const indexBytes = m_indices.size() * sizeof(juce::uint32);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+    orphanBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBytes, m_indexBufferCapacity);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(indexBytes), m_indices.data());
+
+    m_lastFrameStatistics.m_numUploadedBytes += vertexOffsetBytes + indexBytes;
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::SetupRenderState
+(
+    ImDrawData const& i_drawData
+    , int const i_framebufferWidth
+    , int const i_framebufferHeight
+)
+{
+    using namespace juce::gl;
+
+    // Alpha blending, no face culling / depth / stencil testing. Only re-specified once invalidated (See: InvalidateRenderState())
+    if(!m_renderStateValid)
+    {
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_CULL_FACE);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_STENCIL_TEST);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    if(!m_renderStateValid || m_currentViewport[0] != i_framebufferWidth || m_currentViewport[1] != i_framebufferHeight)
+    {
+        glViewport(0, 0, i_framebufferWidth, i_framebufferHeight);
+        m_currentViewport[0] = i_framebufferWidth;
+        m_currentViewport[1] = i_framebufferHeight;
+    }
+
+    m_renderStateValid = true;
+
+    // Note: Disabled after each frame for Juce (See: RenderDrawData()), so always enabled
+    glEnable(GL_SCISSOR_TEST);
+
+    // Orthographic projection of the ImGui display rect (top left origin)
+    float const left = i_drawData.DisplayPos.x;
+    float const right = i_drawData.DisplayPos.x + i_drawData.DisplaySize.x;
+    float const top = i_drawData.DisplayPos.y;
+    float const bottom = i_drawData.DisplayPos.y + i_drawData.DisplaySize.y;
+
+    m_shaderProgram->use();
+
+    // Uniforms are program state, untouched by others, so the projection is only set when the display rect changes
+    float const projectionRect[4] = { left, right, top, bottom };
+    if(!m_projectionValid || std::memcmp(projectionRect, m_currentProjectionRect, sizeof(projectionRect)) != 0)
+    {
+        GLfloat const projectionMatrix[16] =
+        {
+            2.0f / (right - left),              0.0f,                               0.0f,   0.0f,
+            0.0f,                               2.0f / (top - bottom),              0.0f,   0.0f,
+            0.0f,                               0.0f,                               -1.0f,  0.0f,
+            (right + left) / (left - right),    (top + bottom) / (bottom - top),    0.0f,   1.0f,
+        };
+
+        m_projectionMatrixUniform->setMatrix4(projectionMatrix, 1, GL_FALSE);
+        std::memcpy(m_currentProjectionRect, projectionRect, sizeof(projectionRect));
+        m_projectionValid = true;
+    }
+
+    if(m_vertexArrayObject != 0)
+    {
+        glBindVertexArray(m_vertexArrayObject);
+    }
+    else
+    {
+        SetupVertexAttributes();
+    }
+
+    // Reset the cached state, so the next draw binds its texture / scissor
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_boundTextureID = 0;
+    m_currentScissor[2] = -1;
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::SetupVertexAttributes()
+{
+    using namespace juce::gl;
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+
+    glEnableVertexAttribArray(m_positionAttribute);
+    glEnableVertexAttribArray(m_uvAttribute);
+    glEnableVertexAttribArray(m_colourAttribute);
+    glVertexAttribPointer(m_positionAttribute, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), reinterpret_cast<void const*>(offsetof(ImDrawVert, pos)));
+    glVertexAttribPointer(m_uvAttribute, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), reinterpret_cast<void const*>(offsetof(ImDrawVert, uv)));
+    glVertexAttribPointer(m_colourAttribute, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), reinterpret_cast<void const*>(offsetof(ImDrawVert, col)));
+}
+
+//==============================================================================
+void ImGui_Juce_OpenGLRenderer::InvalidateRenderState()
+{
+    m_renderStateValid = false;
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,147 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Juce native OpenGL Renderer for the Juce Platform Backend
+// Built on juce::OpenGLShaderProgram and the Juce GL loader (juce::gl). Use instead of imgui_impl_opengl3
+// - Each frame orphans (streams) the vertex / index buffers. Draw list vertices are uploaded in place, without a CPU copy
+// - Only indices are rebased on the CPU, into 32 bit indices, so consecutive draw commands can merge across draw lists
+//   (Same texture and clip rect -> a single glDrawElements())
+// - The vertex layout is recorded once in a vertex array object (core profile), uniforms are only set when changed
+// - Texture / scissor state is cached within the frame, so redundant binds are skipped
+//   Blend / depth / viewport state across frames too, for contexts rendering nothing else (See: SetExclusiveContext())
+
+// Usage (render thread):
+//  juce::OpenGLRenderer::newOpenGLContextCreated():
+//      m_imGuiRenderer = std::make_unique<ImGui_Juce_OpenGLRenderer>(m_openGLContext);
+//      m_imGuiRenderer->Init();    // (with the ImGuiContext current)
+//  juce::OpenGLRenderer::renderOpenGL():
+//      ImGui::Render();
+//      m_imGuiRenderer->RenderDrawData(*ImGui::GetDrawData());
+//  juce::OpenGLRenderer::openGLContextClosing():
+//      m_imGuiRenderer->Shutdown();
+//      m_imGuiRenderer.reset();
+
+// Note: Requires 32 bit index support (desktop GL, GLES3 / OES_element_index_uint)
+// Note: Leaves blending enabled, and the program / buffers / texture unbound after rendering
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_opengl/juce_opengl.h>
+
+#include <memory>
+#include <vector>
+
+//==============================================================================
+class ImGui_Juce_OpenGLRenderer
+{
+public:
+    struct Statistics
+    {
+        int m_numDrawCmds = 0;          // ImDrawCmds submitted by ImGui (excluding callbacks)
+        int m_numDrawCalls = 0;         // glDrawElements() calls after merging
+        size_t m_numUploadedBytes = 0;  // Vertex + index bytes uploaded
+    };
+
+    explicit ImGui_Juce_OpenGLRenderer(juce::OpenGLContext& i_openGLContext);
+    ~ImGui_Juce_OpenGLRenderer();
+    ImGui_Juce_OpenGLRenderer(ImGui_Juce_OpenGLRenderer const&) = delete;
+
+    ImGui_Juce_OpenGLRenderer& operator=(ImGui_Juce_OpenGLRenderer const&) = delete;
+    bool operator==(ImGui_Juce_OpenGLRenderer const&) = delete;
+    bool operator!=(ImGui_Juce_OpenGLRenderer const&) = delete;
+
+    //==============================================================================
+    // Creates the shader program, buffers and font atlas texture. Returns false if the shader fails to compile
+    // Note: Render thread, with the openGL context active and the ImGuiContext current
+    bool Init();
+    void Shutdown();
+
+    //==============================================================================
+    void RenderDrawData(ImDrawData const& i_drawData);
+
+    // Re-uploads the font atlas, e.g. after adding fonts (render thread)
+    void CreateFontsTexture();
+    void DestroyFontsTexture();
+    ImTextureID GetFontsTextureID() const;
+
+    Statistics GetLastFrameStatistics() const;
+
+    // The openGL context renders nothing but this renderer, e.g. juce::OpenGLContext::setComponentPaintingEnabled(false)
+    // GL state from previous frames can then be trusted, so blend / depth / viewport state is only re-specified when changed
+    // Default false: Juce's component painting changes blend state between frames, so it is re-specified once per frame
+    void SetExclusiveContext(bool i_exclusiveContext);
+
+    //==============================================================================
+    // Vertex / index buffer memory (GL buffers + CPU staging), excluding the font atlas texture
+    size_t GetBufferMemoryBytes() const;
+
+    // Frees the vertex / index buffer storage, e.g. while the editor is hidden (See: ImGui_Juce_Backend::SetRendererMemoryFunctions())
+    // The buffers regrow on the next RenderDrawData(). Render thread, with the openGL context active
+    void ReleaseBuffers();
+
+private:
+    //==============================================================================
+    struct DrawOp
+    {
+        ImDrawList const* m_drawList;   // Callbacks only
+        ImDrawCmd const* m_drawCmd;     // Callbacks only, nullptr for merged draws
+        juce::gl::GLuint m_textureID;
+        int m_scissor[4];               // x, y, width, height (framebuffer pixels)
+        juce::uint32 m_firstIndex;
+        juce::uint32 m_indexCount;
+    };
+
+    //==============================================================================
+    void BuildDrawOps(ImDrawData const& i_drawData, int i_framebufferWidth, int i_framebufferHeight);
+    void UploadBuffers(ImDrawData const& i_drawData);
+    void SetupRenderState(ImDrawData const& i_drawData, int i_framebufferWidth, int i_framebufferHeight);
+    void SetupVertexAttributes();   // Once into the vertex array object (See: Init()), per SetupRenderState() without one
+    void InvalidateRenderState();
+
+    //==============================================================================
+    // Constructor initialisation order:
+    juce::OpenGLContext& m_openGLContext;
+
+    //==============================================================================
+    std::unique_ptr<juce::OpenGLShaderProgram> m_shaderProgram;
+    std::unique_ptr<juce::OpenGLShaderProgram::Uniform> m_projectionMatrixUniform;
+    std::unique_ptr<juce::OpenGLShaderProgram::Uniform> m_textureUniform;
+    juce::gl::GLuint m_positionAttribute = 0;
+    juce::gl::GLuint m_uvAttribute = 0;
+    juce::gl::GLuint m_colourAttribute = 0;
+
+    juce::gl::GLuint m_vertexArrayObject = 0;   // Core profile only
+    juce::gl::GLuint m_vertexBuffer = 0;
+    juce::gl::GLuint m_indexBuffer = 0;
+    size_t m_vertexBufferCapacity = 0;
+    size_t m_indexBufferCapacity = 0;
+    juce::gl::GLuint m_fontsTexture = 0;
+
+    //==============================================================================
+    // Per frame CPU staging, reused so steady state rendering doesn't allocate
+    // Note: No vertex staging, draw list vertex buffers are uploaded directly (See: UploadBuffers())
+    std::vector<juce::uint32> m_indices;
+    std::vector<DrawOp> m_drawOps;
+    size_t m_numVertices = 0;
+
+    // Cached GL state within the frame (See: SetupRenderState())
+    juce::gl::GLuint m_boundTextureID = 0;
+    int m_currentScissor[4] = {};
+
+    // Cached GL state across frames: blend / depth / viewport (exclusive contexts only), and our program's uniforms
+    bool m_exclusiveContext = false;
+    bool m_renderStateValid = false;
+    int m_currentViewport[2] = {};
+    float m_currentProjectionRect[4] = {};  // left, right, top, bottom of the projection matrix last set
+    bool m_projectionValid = false;
+
+    Statistics m_lastFrameStatistics;
+};
+
+#endif // #ifndef IMGUI_DISABLE
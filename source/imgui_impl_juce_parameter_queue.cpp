@@ -0,0 +1,326 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Lock-free parameter edit queue for the Juce Platform Backend
+// See imgui_impl_juce_parameter_queue.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_parameter_queue.h"
+
+//==============================================================================
+ImGui_Juce_ParameterQueue::ImGui_Juce_ParameterQueue
+(
+    juce::AudioProcessor& i_audioProcessor
+    , DrainThread const i_drainThread
+    , int const i_queueCapacity /* = 1024 */
+)   : m_parameters(i_audioProcessor.getParameters())
+    , m_drainThread(i_drainThread)
+    , m_fifo(i_queueCapacity)
+    , m_fifoEdits(static_cast<size_t>(i_queueCapacity))
+    , m_pendingEdits(static_cast<size_t>(m_parameters.size()))
+    , m_drainValues(static_cast<size_t>(m_parameters.size()), 0.0f)
+    , m_drainHasValue(static_cast<size_t>(m_parameters.size()), false)
+{
+    // Note: Each parameter's edits are queued in at most 3 entries per frame (begin, value, end)
+    jassert(i_queueCapacity >= 3);
+
+    m_dirtyParameterIndices.reserve(static_cast<size_t>(m_parameters.size()));
+
+    if(m_drainThread == DrainThread::MessageThread)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        startTimer(s_messageThreadDrainIntervalMs);
+    }
+}
+
+//==============================================================================
+ImGui_Juce_ParameterQueue::~ImGui_Juce_ParameterQueue()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::BeginGesture
+(
+    juce::AudioProcessorParameter const& i_parameter
+)
+{
+    PendingEdit& pendingEdit = GetPendingEdit(i_parameter);
+
+    pendingEdit.m_isGestureActive = true;
+
+    // A new gesture before the previous gesture's end was published (same frame, or the queue was full): continue the previous gesture
+    // Rather than queueing begin / end out of order
+    if(pendingEdit.m_endGesture)
+    {
+        pendingEdit.m_endGesture = false;
+        return;
+    }
+
+    pendingEdit.m_beginGesture = true;
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::SetValue
+(
+    juce::AudioProcessorParameter const& i_parameter
+    , float const i_normalisedValue
+)
+{
+    PendingEdit& pendingEdit = GetPendingEdit(i_parameter);
+
+    // Note: Coalesced, only the frame's last value is queued
+    pendingEdit.m_hasValue = true;
+    pendingEdit.m_normalisedValue = juce::jlimit(0.0f, 1.0f, i_normalisedValue);
+
+    pendingEdit.m_hasDisplayValue = true;
+    pendingEdit.m_displayValue = pendingEdit.m_normalisedValue;
+    pendingEdit.m_displayValueFrame = m_currentFrame;
+
+    m_numValueEdits.fetch_add(1, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::EndGesture
+(
+    juce::AudioProcessorParameter const& i_parameter
+)
+{
+    PendingEdit& pendingEdit = GetPendingEdit(i_parameter);
+
+    pendingEdit.m_endGesture = true;
+    pendingEdit.m_isGestureActive = false;
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::PublishFrame()
+{
+    // Note: Edits which don't fit in the queue stay dirty, and are retried next frame (still coalesced)
+    size_t numRemainingDirty = 0;
+    for(int const parameterIndex : m_dirtyParameterIndices)
+    {
+        if(!PublishPendingEdit(parameterIndex))
+        {
+            m_dirtyParameterIndices[numRemainingDirty++] = parameterIndex;
+        }
+    }
+    m_dirtyParameterIndices.resize(numRemainingDirty);
+
+    ++m_currentFrame;
+}
+
+//==============================================================================
+float ImGui_Juce_ParameterQueue::GetDisplayValue
+(
+    juce::AudioProcessorParameter const& i_parameter
+)
+{
+    int const parameterIndex = i_parameter.getParameterIndex();
+    jassert(juce::isPositiveAndBelow(parameterIndex, static_cast<int>(m_pendingEdits.size())));
+
+    PendingEdit& pendingEdit = m_pendingEdits[static_cast<size_t>(parameterIndex)];
+    if(pendingEdit.m_hasDisplayValue)
+    {
+        bool const isApplied = !pendingEdit.m_isDirty
+                            && m_lastAppliedFrame.load(std::memory_order_acquire) >= pendingEdit.m_displayValueFrame;
+        if(pendingEdit.m_isGestureActive || !isApplied)
+        {
+            return pendingEdit.m_displayValue;
+        }
+
+        pendingEdit.m_hasDisplayValue = false;
+    }
+
+    return i_parameter.getValue();
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::Drain()
+{
+    if(m_fifo.getNumReady() == 0)
+    {
+        return;
+    }
+
+    juce::uint32 lastFrame = 0;
+
+    // Values are coalesced across all frames of this drain, and applied before a parameter's end gesture (and at the end)
+    {
+        juce::AbstractFifo::ScopedRead const scopedRead = m_fifo.read(m_fifo.getNumReady());
+        scopedRead.forEach([this, &lastFrame](int const i_fifoIndex)
+        {
+            Edit const& edit = m_fifoEdits[static_cast<size_t>(i_fifoIndex)];
+            lastFrame = edit.m_frame;
+
+            switch(edit.m_editType)
+            {
+                case EditType::BeginGesture:
+                    ApplyValue(edit.m_parameterIndex);
+                    m_parameters[edit.m_parameterIndex]->beginChangeGesture();
+                    break;
+                case EditType::Value:
+                    m_drainValues[static_cast<size_t>(edit.m_parameterIndex)] = edit.m_normalisedValue;
+                    m_drainHasValue[static_cast<size_t>(edit.m_parameterIndex)] = true;
+                    break;
+                case EditType::EndGesture:
+                    ApplyValue(edit.m_parameterIndex);
+                    m_parameters[edit.m_parameterIndex]->endChangeGesture();
+                    break;
+            }
+        });
+    }
+
+    for(int parameterIndex = 0; parameterIndex < m_parameters.size(); ++parameterIndex)
+    {
+        ApplyValue(parameterIndex);
+    }
+
+    m_lastAppliedFrame.store(lastFrame, std::memory_order_release);
+}
+
+//==============================================================================
+ImGui_Juce_ParameterQueue::Statistics ImGui_Juce_ParameterQueue::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.m_numValueEdits = m_numValueEdits.load(std::memory_order_relaxed);
+    statistics.m_numHostNotifications = m_numHostNotifications.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::timerCallback()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    Drain();
+}
+
+//==============================================================================
+ImGui_Juce_ParameterQueue::PendingEdit& ImGui_Juce_ParameterQueue::GetPendingEdit
+(
+    juce::AudioProcessorParameter const& i_parameter
+)
+{
+    int const parameterIndex = i_parameter.getParameterIndex();
+
+    // Note: Parameters must belong to the juce::AudioProcessor the queue was created with
+    jassert(juce::isPositiveAndBelow(parameterIndex, static_cast<int>(m_pendingEdits.size())));
+    jassert(m_parameters[parameterIndex] == &i_parameter);
+
+    PendingEdit& pendingEdit = m_pendingEdits[static_cast<size_t>(parameterIndex)];
+    if(!pendingEdit.m_isDirty)
+    {
+        pendingEdit.m_isDirty = true;
+        m_dirtyParameterIndices.push_back(parameterIndex);
+    }
+
+    return pendingEdit;
+}
+
+//==============================================================================
+bool ImGui_Juce_ParameterQueue::PublishPendingEdit
+(
+    int const i_parameterIndex
+)
+{
+    PendingEdit& pendingEdit = m_pendingEdits[static_cast<size_t>(i_parameterIndex)];
+
+    int const numEdits = (pendingEdit.m_beginGesture ? 1 : 0) + (pendingEdit.m_hasValue ? 1 : 0) + (pendingEdit.m_endGesture ? 1 : 0);
+    if(m_fifo.getFreeSpace() < numEdits)
+    {
+        return false;
+    }
+
+    juce::AbstractFifo::ScopedWrite const scopedWrite = m_fifo.write(numEdits);
+    EditType editTypes[3];
+    int numEditTypes = 0;
+
+    if(pendingEdit.m_beginGesture)
+    {
+        editTypes[numEditTypes++] = EditType::BeginGesture;
+    }
+    if(pendingEdit.m_hasValue)
+    {
+        editTypes[numEditTypes++] = EditType::Value;
+    }
+    if(pendingEdit.m_endGesture)
+    {
+        editTypes[numEditTypes++] = EditType::EndGesture;
+    }
+
+    int editIndex = 0;
+    scopedWrite.forEach([this, &pendingEdit, &editTypes, &editIndex, i_parameterIndex](int const i_fifoIndex)
+    {
+        m_fifoEdits[static_cast<size_t>(i_fifoIndex)] = Edit { i_parameterIndex, editTypes[editIndex++], pendingEdit.m_normalisedValue, m_currentFrame };
+    });
+
+    pendingEdit.m_isDirty = false;
+    pendingEdit.m_beginGesture = false;
+    pendingEdit.m_hasValue = false;
+    pendingEdit.m_endGesture = false;
+
+    // Note: The display value is released once this frame is applied (See: GetDisplayValue())
+    pendingEdit.m_displayValueFrame = m_currentFrame;
+
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_ParameterQueue::ApplyValue
+(
+    int const i_parameterIndex
+)
+{
+    size_t const index = static_cast<size_t>(i_parameterIndex);
+    if(!m_drainHasValue[index])
+    {
+        return;
+    }
+
+    m_drainHasValue[index] = false;
+    m_parameters[i_parameterIndex]->setValueNotifyingHost(m_drainValues[index]);
+    m_numHostNotifications.fetch_add(1, std::memory_order_relaxed);
+}
+
+//==============================================================================
+bool ImGui_Juce_ParameterSlider
+(
+    char const* const i_label
+    , juce::RangedAudioParameter& i_parameter
+    , ImGui_Juce_ParameterQueue& io_parameterQueue
+    , ImGuiSliderFlags const i_flags /* = ImGuiSliderFlags_None */
+)
+{
+    float normalisedValue = io_parameterQueue.GetDisplayValue(i_parameter);
+
+    // Note: The parameter's text is used as the format string, so escape '%' (e.g. "50 %")
+    juce::String const valueText = i_parameter.getText(normalisedValue, 0).replace("%", "%%");
+
+    // Note: Text input would edit the normalised value, so is disabled (ImGuiSliderFlags_NoInput)
+    bool const isChanged = ImGui::SliderFloat(i_label, &normalisedValue, 0.0f, 1.0f, valueText.toRawUTF8(), i_flags | ImGuiSliderFlags_NoInput);
+
+    if(ImGui::IsItemActivated())
+    {
+        io_parameterQueue.BeginGesture(i_parameter);
+    }
+
+    if(isChanged)
+    {
+        io_parameterQueue.SetValue(i_parameter, normalisedValue);
+    }
+
+    if(ImGui::IsItemDeactivated())
+    {
+        io_parameterQueue.EndGesture(i_parameter);
+    }
+
+    return isChanged;
+}
+
+#endif // #ifndef IMGUI_DISABLE
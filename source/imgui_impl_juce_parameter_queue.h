@@ -0,0 +1,161 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Lock-free parameter edit queue for the Juce Platform Backend
+// Note: ImGui widgets run on the openGL render thread, where juce::AudioProcessorParameter::setValueNotifyingHost()
+// (Host code which may lock / allocate) shouldn't be called
+// Widgets instead write edits + begin / end gestures into a wait-free single producer / single consumer queue:
+// - Edits are coalesced per parameter per frame (only the frame's last value is queued)
+// - The consumer applies them on the message thread (default, polled) or the audio thread (Drain() in processBlock())
+//   With one host notification per parameter per drain
+
+// Usage:
+//  Owned by the editor (message thread drain) or AudioProcessor (audio thread drain), created before the render thread starts:
+//      m_parameterQueue = std::make_unique<ImGui_Juce_ParameterQueue>(audioProcessor, ImGui_Juce_ParameterQueue::DrainThread::MessageThread);
+//  Render thread, within the ImGui frame:
+//      ImGui_Juce_ParameterSlider("Cutoff", *m_cutoffParameter, *m_parameterQueue);
+//      Or custom widgets: BeginGesture() on ImGui::IsItemActivated(), SetValue() on change, EndGesture() on ImGui::IsItemDeactivated()
+//  Render thread, once per frame after the widgets (e.g. after ImGui::Render()):
+//      m_parameterQueue->PublishFrame();
+//  Audio thread drain only, at the start of processBlock():
+//      m_parameterQueue->Drain();
+
+// Note: Edits aren't dropped when the queue is full, they stay coalesced on the render thread until the next PublishFrame()
+// Note: Parameter values are normalised (0 - 1), as juce::AudioProcessorParameter::setValue()
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <atomic>
+#include <vector>
+
+//==============================================================================
+class ImGui_Juce_ParameterQueue   : private juce::Timer
+{
+public:
+    enum class DrainThread
+    {
+        MessageThread,  // Drained by a juce::Timer every s_messageThreadDrainIntervalMs
+        AudioThread     // Drained by the user calling Drain(), e.g. at the start of processBlock()
+    };
+
+    struct Statistics
+    {
+        juce::int64 m_numValueEdits = 0;            // SetValue() calls
+        juce::int64 m_numHostNotifications = 0;     // setValueNotifyingHost() calls after coalescing
+    };
+
+    ImGui_Juce_ParameterQueue(juce::AudioProcessor& i_audioProcessor
+                            , DrainThread i_drainThread
+                            , int i_queueCapacity = 1024);
+    ~ImGui_Juce_ParameterQueue() override;
+    ImGui_Juce_ParameterQueue(ImGui_Juce_ParameterQueue const&) = delete;
+
+    ImGui_Juce_ParameterQueue& operator=(ImGui_Juce_ParameterQueue const&) = delete;
+    bool operator==(ImGui_Juce_ParameterQueue const&) = delete;
+    bool operator!=(ImGui_Juce_ParameterQueue const&) = delete;
+
+    //==============================================================================
+    // Producer (render thread). Wait-free, no allocation
+    void BeginGesture(juce::AudioProcessorParameter const& i_parameter);
+    void SetValue(juce::AudioProcessorParameter const& i_parameter, float i_normalisedValue);
+    void EndGesture(juce::AudioProcessorParameter const& i_parameter);
+
+    // Queues this frame's coalesced edits
+    void PublishFrame();
+
+    // The value a widget should display: the last SetValue() until the consumer has applied it, otherwise the parameter's value
+    // (So a dragged widget doesn't jump back while its edits are in flight)
+    float GetDisplayValue(juce::AudioProcessorParameter const& i_parameter);
+
+    //==============================================================================
+    // Consumer (message thread or audio thread, See: DrainThread). Applies all queued edits. No allocation
+    void Drain();
+
+    //==============================================================================
+    // Safe to call from any thread
+    Statistics GetStatistics() const;
+
+private:
+    //==============================================================================
+    enum class EditType : juce::uint8
+    {
+        BeginGesture,
+        Value,
+        EndGesture
+    };
+
+    struct Edit
+    {
+        int m_parameterIndex;
+        EditType m_editType;
+        float m_normalisedValue;
+        juce::uint32 m_frame;
+    };
+
+    // Producer side coalesced edits of the current frame, per parameter
+    struct PendingEdit
+    {
+        bool m_isDirty = false;
+        bool m_beginGesture = false;
+        bool m_hasValue = false;
+        bool m_endGesture = false;
+        float m_normalisedValue = 0.0f;
+
+        // Display value (See: GetDisplayValue())
+        bool m_isGestureActive = false;
+        bool m_hasDisplayValue = false;
+        float m_displayValue = 0.0f;
+        juce::uint32 m_displayValueFrame = 0;
+    };
+
+    //==============================================================================
+    // juce::Timer override: message thread drain
+    void timerCallback() override;
+
+    PendingEdit& GetPendingEdit(juce::AudioProcessorParameter const& i_parameter);
+    bool PublishPendingEdit(int i_parameterIndex);
+    void ApplyValue(int i_parameterIndex);
+
+    //==============================================================================
+    static constexpr int s_messageThreadDrainIntervalMs = 15;
+
+    //==============================================================================
+    // Constructor initialisation order:
+    juce::Array<juce::AudioProcessorParameter*> const m_parameters;
+    DrainThread const m_drainThread;
+    juce::AbstractFifo m_fifo;
+    std::vector<Edit> m_fifoEdits;
+
+    //==============================================================================
+    // Producer (render thread)
+    std::vector<PendingEdit> m_pendingEdits;
+    std::vector<int> m_dirtyParameterIndices;
+    juce::uint32 m_currentFrame = 1;
+
+    //==============================================================================
+    // Consumer: values coalesced across the frames of one drain
+    std::vector<float> m_drainValues;
+    std::vector<bool> m_drainHasValue;
+    std::atomic<juce::uint32> m_lastAppliedFrame { 0 };
+
+    std::atomic<juce::int64> m_numValueEdits { 0 };
+    std::atomic<juce::int64> m_numHostNotifications { 0 };
+};
+
+//==============================================================================
+// Slider over a parameter's normalised range, displaying the parameter's own text (units, skew and steps respected)
+// Edits are written to i_parameterQueue with begin / end gestures. Returns true when the value changed
+bool ImGui_Juce_ParameterSlider(char const* i_label
+                                , juce::RangedAudioParameter& i_parameter
+                                , ImGui_Juce_ParameterQueue& io_parameterQueue
+                                , ImGuiSliderFlags i_flags = ImGuiSliderFlags_None);
+
+#endif // #ifndef IMGUI_DISABLE
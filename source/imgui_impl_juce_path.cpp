@@ -0,0 +1,455 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: juce::Path drawing into ImDrawList for the Juce Platform Backend
+// See imgui_impl_juce_path.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_path.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+//==============================================================================
+namespace JuceImGuiPath
+{
+    // Note: With 16-bit ImDrawIdx, a single PrimReserve() must stay below 65536 vertices (4 per quad)
+    // Larger paths are reserved in batches, each of which ImGui may start at a new ImDrawCmd::VtxOffset
+    static constexpr int s_maxQuadsPerReserve = (1 << 16) / 4 - 1;
+
+    // FNV-1a
+    class KeyHasher
+    {
+    public:
+        template <typename T>
+        void Add(T const i_value)
+        {
+            static_assert(std::is_arithmetic_v<T>, "Only hash values with a defined representation");
+
+            juce::uint8 const* const bytes = reinterpret_cast<juce::uint8 const*>(&i_value);
+            for(size_t i = 0; i < sizeof(T); i++)
+            {
+                m_hash = (m_hash ^ bytes[i]) * 1099511628211ull;
+            }
+        }
+
+        juce::uint64 GetHash() const
+        {
+            return m_hash;
+        }
+
+    private:
+        juce::uint64 m_hash = 14695981039346656037ull;
+    };
+
+    //==============================================================================
+    // juce::EdgeTable::iterate() callback, collecting coverage runs per line and merging identical runs across lines into quads
+    // Note: Lines without coverage aren't iterated, so a gap in line numbers closes all open runs
+    template <typename t_Quad>
+    class QuadBuilder
+    {
+    public:
+        QuadBuilder(float const i_renderingScale, std::vector<t_Quad>& o_quads)
+            : m_inverseRenderingScale(1.0f / i_renderingScale)
+            , m_quads(o_quads)
+        {
+        }
+
+        //==============================================================================
+        // juce::EdgeTable::iterate() callbacks
+        void setEdgeTableYPos(int const i_y)
+        {
+            if(m_hasLine)
+            {
+                FinishLine();
+
+                if(i_y != m_currentY + 1)
+                {
+                    CloseAllRuns(m_currentY + 1);
+                }
+            }
+
+            m_currentY = i_y;
+            m_hasLine = true;
+        }
+
+        void handleEdgeTablePixel(int const i_x, int const i_alpha)                     { AddRun(i_x, 1, i_alpha); }
+        void handleEdgeTablePixelFull(int const i_x)                                    { AddRun(i_x, 1, 255); }
+        void handleEdgeTableLine(int const i_x, int const i_width, int const i_alpha)   { AddRun(i_x, i_width, i_alpha); }
+        void handleEdgeTableLineFull(int const i_x, int const i_width)                  { AddRun(i_x, i_width, 255); }
+
+        //==============================================================================
+        void Finish()
+        {
+            if(m_hasLine)
+            {
+                FinishLine();
+                CloseAllRuns(m_currentY + 1);
+            }
+        }
+
+    private:
+        struct Run
+        {
+            int m_x;
+            int m_width;
+            int m_alpha;
+            int m_startY;
+        };
+
+        //==============================================================================
+        void AddRun(int const i_x, int const i_width, int const i_alpha)
+        {
+            if(i_alpha <= 0 || i_width <= 0)
+            {
+                return;
+            }
+
+            // Merge with the previous run on this line when contiguous with equal coverage
+            if(!m_lineRuns.empty())
+            {
+                Run& previousRun = m_lineRuns.back();
+                if(previousRun.m_x + previousRun.m_width == i_x && previousRun.m_alpha == i_alpha)
+                {
+                    previousRun.m_width += i_width;
+                    return;
+                }
+            }
+
+            m_lineRuns.push_back(Run { i_x, i_width, juce::jmin(i_alpha, 255), m_currentY });
+        }
+
+        void FinishLine()
+        {
+            // Both sorted by x: identical runs continue their quad, others close (previous line) or open (this line)
+            m_nextOpenRuns.clear();
+            size_t openRunIndex = 0;
+
+            for(Run const& lineRun : m_lineRuns)
+            {
+                while(openRunIndex < m_openRuns.size() && m_openRuns[openRunIndex].m_x < lineRun.m_x)
+                {
+                    CloseRun(m_openRuns[openRunIndex++], m_currentY);
+                }
+
+                if(openRunIndex < m_openRuns.size()
+                    && m_openRuns[openRunIndex].m_x == lineRun.m_x
+                    && m_openRuns[openRunIndex].m_width == lineRun.m_width
+                    && m_openRuns[openRunIndex].m_alpha == lineRun.m_alpha)
+                {
+                    m_nextOpenRuns.push_back(m_openRuns[openRunIndex++]);
+                }
+                else
+                {
+                    m_nextOpenRuns.push_back(lineRun);
+                }
+            }
+
+            while(openRunIndex < m_openRuns.size())
+            {
+                CloseRun(m_openRuns[openRunIndex++], m_currentY);
+            }
+
+            std::swap(m_openRuns, m_nextOpenRuns);
+            m_lineRuns.clear();
+        }
+
+        void CloseAllRuns(int const i_endY)
+        {
+            for(Run const& openRun : m_openRuns)
+            {
+                CloseRun(openRun, i_endY);
+            }
+
+            m_openRuns.clear();
+        }
+
+        void CloseRun(Run const& i_run, int const i_endY)
+        {
+            // Framebuffer pixels -> logical units
+            m_quads.push_back(t_Quad { ImVec2(static_cast<float>(i_run.m_x) * m_inverseRenderingScale, static_cast<float>(i_run.m_startY) * m_inverseRenderingScale)
+                                    , ImVec2(static_cast<float>(i_run.m_x + i_run.m_width) * m_inverseRenderingScale, static_cast<float>(i_endY) * m_inverseRenderingScale)
+                                    , static_cast<juce::uint8>(i_run.m_alpha) });
+        }
+
+        //==============================================================================
+        float const m_inverseRenderingScale;
+        std::vector<t_Quad>& m_quads;
+
+        std::vector<Run> m_lineRuns;
+        std::vector<Run> m_openRuns;
+        std::vector<Run> m_nextOpenRuns;
+        int m_currentY = 0;
+        bool m_hasLine = false;
+    };
+}
+
+//==============================================================================
+ImGui_Juce_PathCache::ImGui_Juce_PathCache
+(
+    int const i_maxUnusedFrames /* = 120 */
+)   : m_maxUnusedFrames(i_maxUnusedFrames)
+{
+}
+
+//==============================================================================
+ImGui_Juce_PathCache::~ImGui_Juce_PathCache() = default;
+
+//==============================================================================
+void ImGui_Juce_PathCache::FillPath
+(
+    ImDrawList& io_drawList
+    , juce::Path const& i_path
+    , ImVec2 const i_position
+    , ImU32 const i_colour
+    , juce::AffineTransform const& i_transform /* = {} */
+)
+{
+    DrawPath(io_drawList, i_path, nullptr, i_position, i_colour, i_transform);
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::StrokePath
+(
+    ImDrawList& io_drawList
+    , juce::Path const& i_path
+    , juce::PathStrokeType const& i_strokeType
+    , ImVec2 const i_position
+    , ImU32 const i_colour
+    , juce::AffineTransform const& i_transform /* = {} */
+)
+{
+    DrawPath(io_drawList, i_path, &i_strokeType, i_position, i_colour, i_transform);
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::NewFrame()
+{
+    ++m_currentFrame;
+
+    size_t numCachedQuads = 0;
+    for(auto it = m_cachedPaths.begin(); it != m_cachedPaths.end();)
+    {
+        if(m_currentFrame - it->second.m_lastUsedFrame > m_maxUnusedFrames)
+        {
+            it = m_cachedPaths.erase(it);
+        }
+        else
+        {
+            numCachedQuads += it->second.m_quads.size();
+            ++it;
+        }
+    }
+
+    m_currentFrameStatistics.m_numCachedPaths = static_cast<int>(m_cachedPaths.size());
+    m_currentFrameStatistics.m_numCachedQuads = numCachedQuads;
+    m_lastFrameStatistics = m_currentFrameStatistics;
+    m_currentFrameStatistics = Statistics();
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::Clear()
+{
+    m_cachedPaths.clear();
+}
+
+//==============================================================================
+ImGui_Juce_PathCache::Statistics ImGui_Juce_PathCache::GetStatistics() const
+{
+    return m_lastFrameStatistics;
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::DrawPath
+(
+    ImDrawList& io_drawList
+    , juce::Path const& i_path
+    , juce::PathStrokeType const* const i_strokeType
+    , ImVec2 const i_position
+    , ImU32 const i_colour
+    , juce::AffineTransform const& i_transform
+)
+{
+    float const renderingScale = ImGui::GetIO().DisplayFramebufferScale.x;
+
+    // The translation moves the cached quads, only the rest of the transform is rasterised
+    juce::AffineTransform const transform = i_transform.withAbsoluteTranslation(0.0f, 0.0f);
+    ImVec2 const position(i_position.x + i_transform.mat02, i_position.y + i_transform.mat12);
+
+    // Untransformed paths are shared by content, transformed ones keep a single entry per call site (e.g. a rotating knob)
+    juce::uint64 const contentKey = ComputeKey(i_path, i_strokeType, renderingScale);
+    juce::uint64 const entryKey = transform.isIdentity() ? contentKey : ComputeCallSiteKey(i_path);
+
+    CachedPath const& cachedPath = FindOrTessellate(entryKey, contentKey, i_path, i_strokeType, transform, renderingScale);
+    DrawQuads(io_drawList, cachedPath.m_quads, position, i_colour, renderingScale);
+}
+
+//==============================================================================
+ImGui_Juce_PathCache::CachedPath const& ImGui_Juce_PathCache::FindOrTessellate
+(
+    juce::uint64 const i_entryKey
+    , juce::uint64 const i_contentKey
+    , juce::Path const& i_path
+    , juce::PathStrokeType const* const i_strokeType
+    , juce::AffineTransform const& i_transform
+    , float const i_renderingScale
+)
+{
+    auto const [it, isInserted] = m_cachedPaths.try_emplace(i_entryKey);
+    CachedPath& cachedPath = it->second;
+    cachedPath.m_lastUsedFrame = m_currentFrame;
+
+    if(!isInserted && cachedPath.m_contentKey == i_contentKey && cachedPath.m_transform == i_transform)
+    {
+        ++m_currentFrameStatistics.m_numCacheHits;
+        return cachedPath;
+    }
+
+    // Note: A call site entry whose path / stroke / transform changed is replaced in place
+    ++m_currentFrameStatistics.m_numTessellations;
+    cachedPath.m_contentKey = i_contentKey;
+    cachedPath.m_transform = i_transform;
+
+    if(i_strokeType != nullptr)
+    {
+        // Note: Stroked in transformed space (as juce::Graphics::strokePath()), so the transform doesn't scale the thickness
+        // With the curve accuracy matching the rendering scale
+        juce::Path strokedPath;
+        i_strokeType->createStrokedPath(strokedPath, i_path, i_transform, i_renderingScale);
+        Tessellate(strokedPath, {}, i_renderingScale, cachedPath.m_quads);
+    }
+    else
+    {
+        Tessellate(i_path, i_transform, i_renderingScale, cachedPath.m_quads);
+    }
+
+    return cachedPath;
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::DrawQuads
+(
+    ImDrawList& io_drawList
+    , std::vector<Quad> const& i_quads
+    , ImVec2 const i_position
+    , ImU32 const i_colour
+    , float const i_renderingScale
+) const
+{
+    juce::uint32 const colourAlpha = (i_colour & IM_COL32_A_MASK) >> IM_COL32_A_SHIFT;
+    if(i_quads.empty() || colourAlpha == 0)
+    {
+        return;
+    }
+
+    // Snap to the framebuffer pixel grid, so the cached coverage lines up with the pixels it was rasterised for
+    ImVec2 const position(std::round(i_position.x * i_renderingScale) / i_renderingScale
+                        , std::round(i_position.y * i_renderingScale) / i_renderingScale);
+    ImU32 const colourRGB = i_colour & ~IM_COL32_A_MASK;
+
+    size_t const numQuads = i_quads.size();
+    for(size_t batchBegin = 0; batchBegin < numQuads; batchBegin += JuceImGuiPath::s_maxQuadsPerReserve)
+    {
+        int const numBatchQuads = static_cast<int>(std::min(numQuads - batchBegin, static_cast<size_t>(JuceImGuiPath::s_maxQuadsPerReserve)));
+        io_drawList.PrimReserve(numBatchQuads * 6, numBatchQuads * 4);
+
+        for(size_t quadIndex = batchBegin; quadIndex < batchBegin + static_cast<size_t>(numBatchQuads); quadIndex++)
+        {
+            Quad const& quad = i_quads[quadIndex];
+            juce::uint32 const alpha = (static_cast<juce::uint32>(quad.m_coverage) * colourAlpha + 127) / 255;
+            io_drawList.PrimRect(ImVec2(position.x + quad.m_min.x, position.y + quad.m_min.y)
+                                , ImVec2(position.x + quad.m_max.x, position.y + quad.m_max.y)
+                                , colourRGB | (alpha << IM_COL32_A_SHIFT));
+        }
+    }
+}
+
+//==============================================================================
+juce::uint64 ImGui_Juce_PathCache::ComputeKey
+(
+    juce::Path const& i_path
+    , juce::PathStrokeType const* const i_strokeType
+    , float const i_renderingScale
+)
+{
+    JuceImGuiPath::KeyHasher keyHasher;
+
+    keyHasher.Add(false);   // Content key (See: ComputeCallSiteKey())
+    keyHasher.Add(i_renderingScale);
+
+    keyHasher.Add(i_strokeType != nullptr);
+    if(i_strokeType != nullptr)
+    {
+        keyHasher.Add(i_strokeType->getStrokeThickness());
+        keyHasher.Add(static_cast<int>(i_strokeType->getJointStyle()));
+        keyHasher.Add(static_cast<int>(i_strokeType->getEndStyle()));
+    }
+
+    keyHasher.Add(i_path.isUsingNonZeroWinding());
+
+    juce::Path::Iterator pathIterator(i_path);
+    while(pathIterator.next())
+    {
+        keyHasher.Add(static_cast<int>(pathIterator.elementType));
+        keyHasher.Add(pathIterator.x1);
+        keyHasher.Add(pathIterator.y1);
+        keyHasher.Add(pathIterator.x2);
+        keyHasher.Add(pathIterator.y2);
+        keyHasher.Add(pathIterator.x3);
+        keyHasher.Add(pathIterator.y3);
+    }
+
+    return keyHasher.GetHash();
+}
+
+//==============================================================================
+juce::uint64 ImGui_Juce_PathCache::ComputeCallSiteKey
+(
+    juce::Path const& i_path
+)
+{
+    // Note: Render thread, within an ImGui window (the ID stack identifies the call site)
+    JuceImGuiPath::KeyHasher keyHasher;
+
+    keyHasher.Add(true);    // Call site key (See: ComputeKey())
+    keyHasher.Add(ImGui::GetID(static_cast<void const*>(&i_path)));
+
+    return keyHasher.GetHash();
+}
+
+//==============================================================================
+void ImGui_Juce_PathCache::Tessellate
+(
+    juce::Path const& i_path
+    , juce::AffineTransform const& i_transform
+    , float const i_renderingScale
+    , std::vector<Quad>& o_quads
+)
+{
+    o_quads.clear();
+
+    // Logical units -> framebuffer pixels
+    juce::AffineTransform const transform = i_transform.scaled(i_renderingScale);
+    juce::Rectangle<int> const bounds = i_path.getBoundsTransformed(transform).getSmallestIntegerContainer().expanded(1);
+    if(bounds.isEmpty())
+    {
+        return;
+    }
+
+    juce::EdgeTable const edgeTable(bounds, i_path, transform);
+
+    JuceImGuiPath::QuadBuilder<Quad> quadBuilder(i_renderingScale, o_quads);
+    edgeTable.iterate(quadBuilder);
+    quadBuilder.Finish();
+
+    o_quads.shrink_to_fit();
+}
+
+#endif // #ifndef IMGUI_DISABLE
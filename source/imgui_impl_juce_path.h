@@ -0,0 +1,137 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: juce::Path drawing into ImDrawList for the Juce Platform Backend
+// Paths (filled, or stroked with juce::PathStrokeType) are rasterised with juce::EdgeTable at the framebuffer resolution
+// Then converted to coverage quads (horizontal runs of equal anti-aliasing coverage, merged with identical runs on the following lines)
+// So paths keep Juce's fill rules (non-zero / even-odd winding, holes) and anti-aliasing
+// The quads are cached per path hash + stroke + rendering scale, so an unchanged path costs a vertex copy per frame
+// Paths drawn with a rotation / scale / shear are cached per call site instead (ImGui ID stack + juce::Path object), replacing the previous entry
+
+// Usage (render thread, within the ImGui frame):
+//  m_pathCache = std::make_unique<ImGui_Juce_PathCache>();  // e.g. per editor
+//  m_pathCache->NewFrame();   // once per frame, evicts paths unused for i_maxUnusedFrames
+//  m_pathCache->FillPath(*ImGui::GetWindowDrawList(), m_knobPath, ImGui::GetCursorScreenPos(), IM_COL32(255, 160, 0, 255));
+//  m_pathCache->StrokePath(*ImGui::GetWindowDrawList(), m_envelopePath, juce::PathStrokeType(2.0f), position, colour);
+
+// Note: Path coordinates are ImGui logical units (before io.DisplayFramebufferScale), relative to i_position
+// Moving a path: change i_position or i_transform's translation (cached). Changing the rest of i_transform / the path itself: re-rasterised
+// Note: A rotating knob re-rasterises on each transform change (coverage runs are axis aligned), but keeps a single cache entry
+// Drawing the same juce::Path object with different transforms in one window: separate them with ImGui::PushID()
+// Note: Strokes are created in transformed space, so i_transform doesn't scale the stroke thickness (as juce::Graphics::strokePath())
+// Note: Colour changes are applied per vertex, so animating a path's colour doesn't re-rasterise it
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_graphics/juce_graphics.h>
+
+#include <unordered_map>
+#include <vector>
+
+//==============================================================================
+class ImGui_Juce_PathCache
+{
+public:
+    struct Statistics
+    {
+        int m_numCachedPaths = 0;
+        size_t m_numCachedQuads = 0;
+        int m_numTessellations = 0;     // Cache misses in the last frame
+        int m_numCacheHits = 0;         // In the last frame
+    };
+
+    explicit ImGui_Juce_PathCache(int i_maxUnusedFrames = 120);
+    ~ImGui_Juce_PathCache();
+    ImGui_Juce_PathCache(ImGui_Juce_PathCache const&) = delete;
+
+    ImGui_Juce_PathCache& operator=(ImGui_Juce_PathCache const&) = delete;
+    bool operator==(ImGui_Juce_PathCache const&) = delete;
+    bool operator!=(ImGui_Juce_PathCache const&) = delete;
+
+    //==============================================================================
+    // Note: Render thread, with the ImGuiContext current (the rendering scale is io.DisplayFramebufferScale)
+    void FillPath(ImDrawList& io_drawList
+                , juce::Path const& i_path
+                , ImVec2 i_position
+                , ImU32 i_colour
+                , juce::AffineTransform const& i_transform = {});
+
+    void StrokePath(ImDrawList& io_drawList
+                , juce::Path const& i_path
+                , juce::PathStrokeType const& i_strokeType
+                , ImVec2 i_position
+                , ImU32 i_colour
+                , juce::AffineTransform const& i_transform = {});
+
+    //==============================================================================
+    // Once per frame: rolls the statistics and evicts paths unused for i_maxUnusedFrames
+    void NewFrame();
+    void Clear();
+
+    Statistics GetStatistics() const;
+
+private:
+    //==============================================================================
+    // A run of pixels with equal coverage, spanning one or more lines (logical units, relative to the path's position)
+    struct Quad
+    {
+        ImVec2 m_min;
+        ImVec2 m_max;
+        juce::uint8 m_coverage;
+    };
+
+    struct CachedPath
+    {
+        std::vector<Quad> m_quads;
+        juce::uint64 m_contentKey = 0;
+        juce::AffineTransform m_transform;  // Without translation, identity for entries keyed by content
+        int m_lastUsedFrame = 0;
+    };
+
+    //==============================================================================
+    void DrawPath(ImDrawList& io_drawList
+                , juce::Path const& i_path
+                , juce::PathStrokeType const* i_strokeType
+                , ImVec2 i_position
+                , ImU32 i_colour
+                , juce::AffineTransform const& i_transform);
+
+    CachedPath const& FindOrTessellate(juce::uint64 i_entryKey
+                                    , juce::uint64 i_contentKey
+                                    , juce::Path const& i_path
+                                    , juce::PathStrokeType const* i_strokeType
+                                    , juce::AffineTransform const& i_transform
+                                    , float i_renderingScale);
+
+    void DrawQuads(ImDrawList& io_drawList, std::vector<Quad> const& i_quads, ImVec2 i_position, ImU32 i_colour, float i_renderingScale) const;
+
+    static juce::uint64 ComputeKey(juce::Path const& i_path
+                                , juce::PathStrokeType const* i_strokeType
+                                , float i_renderingScale);
+
+    static juce::uint64 ComputeCallSiteKey(juce::Path const& i_path);
+
+    static void Tessellate(juce::Path const& i_path
+                        , juce::AffineTransform const& i_transform
+                        , float i_renderingScale
+                        , std::vector<Quad>& o_quads);
+
+    //==============================================================================
+    // Constructor initialisation order:
+    int const m_maxUnusedFrames;
+
+    //==============================================================================
+    std::unordered_map<juce::uint64, CachedPath> m_cachedPaths;     // Keyed by content (ComputeKey) or call site (ComputeCallSiteKey)
+    int m_currentFrame = 0;
+
+    Statistics m_currentFrameStatistics;
+    Statistics m_lastFrameStatistics;
+};
+
+#endif // #ifndef IMGUI_DISABLE
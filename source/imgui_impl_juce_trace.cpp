@@ -0,0 +1,309 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Timeline tracing for the Juce Platform Backend
+// See imgui_impl_juce_trace.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_trace.h"
+
+#include <juce_events/juce_events.h>
+
+#include <memory>
+#include <vector>
+
+std::atomic<bool> ImGui_Juce_TraceSession::s_active { false };
+
+namespace JuceImGuiTrace
+{
+    struct Event
+    {
+        char const* m_name;
+        juce::int64 m_beginTicks;
+        juce::int64 m_endTicks;
+    };
+
+    //==============================================================================
+    // Single producer (the owning thread) / single consumer (the flush thread) ring buffer
+    struct ThreadBuffer
+    {
+        static constexpr juce::uint32 s_capacity = 4096; // power of 2
+        static constexpr juce::uint32 s_indexMask = s_capacity - 1;
+
+        Event m_events[s_capacity];
+        std::atomic<juce::uint32> m_writeIndex { 0 };
+        std::atomic<juce::uint32> m_readIndex { 0 };
+
+        int m_traceThreadID = 0;
+        juce::String m_threadName;
+        bool m_threadNameWritten = false;   // per session, flush thread only
+    };
+
+    //==============================================================================
+    class FlushThread : public juce::Thread
+    {
+    public:
+        explicit FlushThread(int i_flushIntervalMs)
+            : juce::Thread("ImGui Juce Trace Flush")
+            , m_flushIntervalMs(i_flushIntervalMs)
+        {
+        }
+
+        void run() override;
+
+    private:
+        int m_flushIntervalMs;
+    };
+
+    //==============================================================================
+    struct SessionState
+    {
+        // Guards everything below, except the ring buffer indices. Held by the flush thread while writing
+        juce::CriticalSection m_lock;
+
+        // Note: Thread buffers are never freed, as threads cache a pointer to theirs (See: t_threadBuffer)
+        // Bounded by the number of threads which have ever recorded an event
+        std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;
+
+        std::unique_ptr<juce::FileOutputStream> m_fileOutputStream;
+        std::unique_ptr<FlushThread> m_flushThread;
+        juce::int64 m_startTicks = 0;
+        juce::uint64 m_numEventsWritten = 0;
+        std::atomic<juce::uint64> m_numEventsDropped { 0 };
+    };
+
+    //==============================================================================
+    static SessionState& GetSessionState()
+    {
+        static SessionState s_sessionState;
+        return s_sessionState;
+    }
+
+    thread_local ThreadBuffer* t_threadBuffer = nullptr;
+}
+
+//==============================================================================
+static double ImGui_ImplJuce_TicksToMicroseconds
+(
+    juce::int64 const i_ticks
+)
+{
+    return static_cast<double>(i_ticks) * 1.0e6 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+}
+
+//==============================================================================
+static JuceImGuiTrace::ThreadBuffer* ImGui_ImplJuce_RegisterThreadBuffer()
+{
+    JuceImGuiTrace::SessionState& sessionState = JuceImGuiTrace::GetSessionState();
+    juce::ScopedLock const lock(sessionState.m_lock);
+
+    auto threadBuffer = std::make_unique<JuceImGuiTrace::ThreadBuffer>();
+    threadBuffer->m_traceThreadID = static_cast<int>(sessionState.m_threadBuffers.size()) + 1;
+
+    juce::MessageManager* const messageManager = juce::MessageManager::getInstanceWithoutCreating();
+
+    if(messageManager != nullptr && messageManager->isThisTheMessageThread())
+    {
+        threadBuffer->m_threadName = "Message Thread";
+    }
+    else if(juce::Thread* const currentThread = juce::Thread::getCurrentThread())
+    {
+        threadBuffer->m_threadName = currentThread->getThreadName();
+    }
+    else
+    {
+        threadBuffer->m_threadName = "Thread " + juce::String(threadBuffer->m_traceThreadID); // e.g. a host thread
+    }
+
+    sessionState.m_threadBuffers.push_back(std::move(threadBuffer));
+    return sessionState.m_threadBuffers.back().get();
+}
+
+//==============================================================================
+// Writes all buffered events to the file. Called with m_lock held
+static void ImGui_ImplJuce_FlushThreadBuffers
+(
+    JuceImGuiTrace::SessionState& io_sessionState
+)
+{
+    jassert(io_sessionState.m_fileOutputStream != nullptr);
+    juce::FileOutputStream& fileOutputStream = *io_sessionState.m_fileOutputStream;
+
+    auto const writeSeparator = [&io_sessionState, &fileOutputStream]()
+    {
+        fileOutputStream << (io_sessionState.m_numEventsWritten++ == 0 ? "\n" : ",\n");
+    };
+
+    for(std::unique_ptr<JuceImGuiTrace::ThreadBuffer> const& threadBuffer : io_sessionState.m_threadBuffers)
+    {
+        juce::uint32 const readIndex = threadBuffer->m_readIndex.load(std::memory_order_relaxed);
+        juce::uint32 const writeIndex = threadBuffer->m_writeIndex.load(std::memory_order_acquire);
+
+        if(readIndex == writeIndex)
+        {
+            continue;
+        }
+
+        juce::String const traceThreadID(threadBuffer->m_traceThreadID);
+
+        if(!threadBuffer->m_threadNameWritten)
+        {
+            writeSeparator();
+            fileOutputStream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << traceThreadID
+                             << ",\"args\":{\"name\":" << juce::JSON::toString(juce::var(threadBuffer->m_threadName)) << "}}";
+            threadBuffer->m_threadNameWritten = true;
+        }
+
+        for(juce::uint32 eventIndex = readIndex; eventIndex != writeIndex; eventIndex++)
+        {
+            JuceImGuiTrace::Event const& event = threadBuffer->m_events[eventIndex & JuceImGuiTrace::ThreadBuffer::s_indexMask];
+
+            // Note: Ignore scopes which began before the session started
+            if(event.m_beginTicks < io_sessionState.m_startTicks)
+            {
+                continue;
+            }
+
+            // Chrome trace event "complete" event, timestamps in microseconds
+            writeSeparator();
+            fileOutputStream << "{\"name\":" << juce::JSON::toString(juce::var(juce::String(event.m_name)))
+                             << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << traceThreadID
+                             << ",\"ts\":" << juce::String(ImGui_ImplJuce_TicksToMicroseconds(event.m_beginTicks - io_sessionState.m_startTicks), 3)
+                             << ",\"dur\":" << juce::String(ImGui_ImplJuce_TicksToMicroseconds(event.m_endTicks - event.m_beginTicks), 3)
+                             << "}";
+        }
+
+        threadBuffer->m_readIndex.store(writeIndex, std::memory_order_release);
+    }
+
+    fileOutputStream.flush();
+}
+
+//==============================================================================
+void JuceImGuiTrace::FlushThread::run()
+{
+    JuceImGuiTrace::SessionState& sessionState = JuceImGuiTrace::GetSessionState();
+
+    while(!threadShouldExit())
+    {
+        wait(m_flushIntervalMs);
+
+        juce::ScopedLock const lock(sessionState.m_lock);
+        ImGui_ImplJuce_FlushThreadBuffers(sessionState);
+    }
+}
+
+//==============================================================================
+bool ImGui_Juce_TraceSession::Start
+(
+    juce::File const& i_traceFile
+    , int const i_flushIntervalMs /* = 250 */
+)
+{
+    // Note: Start() / Stop() must not be called concurrently with each other
+    Stop();
+
+    JuceImGuiTrace::SessionState& sessionState = JuceImGuiTrace::GetSessionState();
+
+    {
+        juce::ScopedLock const lock(sessionState.m_lock);
+
+        i_traceFile.deleteFile();
+        sessionState.m_fileOutputStream = std::make_unique<juce::FileOutputStream>(i_traceFile);
+
+        if(sessionState.m_fileOutputStream->failedToOpen())
+        {
+            sessionState.m_fileOutputStream.reset();
+            return false;
+        }
+
+        *sessionState.m_fileOutputStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        // Discard events left over from a previous session (the consumer owns the read index)
+        for(std::unique_ptr<JuceImGuiTrace::ThreadBuffer> const& threadBuffer : sessionState.m_threadBuffers)
+        {
+            threadBuffer->m_readIndex.store(threadBuffer->m_writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+            threadBuffer->m_threadNameWritten = false;
+        }
+
+        sessionState.m_startTicks = juce::Time::getHighResolutionTicks();
+        sessionState.m_numEventsWritten = 0;
+        sessionState.m_numEventsDropped = 0;
+    }
+
+    sessionState.m_flushThread = std::make_unique<JuceImGuiTrace::FlushThread>(juce::jmax(1, i_flushIntervalMs));
+    sessionState.m_flushThread->startThread();
+
+    s_active = true;
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_TraceSession::Stop()
+{
+    JuceImGuiTrace::SessionState& sessionState = JuceImGuiTrace::GetSessionState();
+
+    s_active = false;
+
+    if(sessionState.m_flushThread != nullptr)
+    {
+        sessionState.m_flushThread->signalThreadShouldExit();
+        sessionState.m_flushThread->notify();
+        sessionState.m_flushThread->stopThread(5000);
+        sessionState.m_flushThread.reset();
+    }
+
+    juce::ScopedLock const lock(sessionState.m_lock);
+
+    if(sessionState.m_fileOutputStream == nullptr)
+    {
+        return;
+    }
+
+    ImGui_ImplJuce_FlushThreadBuffers(sessionState);
+
+    *sessionState.m_fileOutputStream << "\n]}\n";
+    sessionState.m_fileOutputStream.reset();
+}
+
+//==============================================================================
+void ImGui_Juce_TraceSession::RecordEvent
+(
+    char const* const i_name
+    , juce::int64 const i_beginTicks
+    , juce::int64 const i_endTicks
+)
+{
+    JuceImGuiTrace::ThreadBuffer* threadBuffer = JuceImGuiTrace::t_threadBuffer;
+
+    if(threadBuffer == nullptr)
+    {
+        threadBuffer = ImGui_ImplJuce_RegisterThreadBuffer();
+        JuceImGuiTrace::t_threadBuffer = threadBuffer;
+    }
+
+    juce::uint32 const writeIndex = threadBuffer->m_writeIndex.load(std::memory_order_relaxed);
+    juce::uint32 const readIndex = threadBuffer->m_readIndex.load(std::memory_order_acquire);
+
+    if(writeIndex - readIndex >= JuceImGuiTrace::ThreadBuffer::s_capacity)
+    {
+        JuceImGuiTrace::GetSessionState().m_numEventsDropped++;
+        return;
+    }
+
+    threadBuffer->m_events[writeIndex & JuceImGuiTrace::ThreadBuffer::s_indexMask] = { i_name, i_beginTicks, i_endTicks };
+    threadBuffer->m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+//==============================================================================
+juce::uint64 ImGui_Juce_TraceSession::GetNumEventsDropped()
+{
+    return JuceImGuiTrace::GetSessionState().m_numEventsDropped.load();
+}
+
+#endif // #ifndef IMGUI_DISABLE
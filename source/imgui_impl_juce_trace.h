@@ -0,0 +1,108 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Timeline tracing for the Juce Platform Backend
+// Records scoped trace events (backend NewFrame, message thread updates, input events, user UI / render phases)
+// Into lock-free per-thread buffers, flushed by a background thread to a Chrome trace event JSON file
+// Open the file with https://ui.perfetto.dev or chrome://tracing
+
+// Enable with Juce_ImGuiBackend_Trace in imgui_impl_juce_config.h
+// When disabled, Juce_ImGuiTrace_Scope() compiles away entirely (this file isn't required)
+// When enabled but no session is active, each scope costs a single relaxed atomic load
+
+// Usage:
+//  Start / stop a session (any thread, e.g. from a debug menu):
+//      ImGui_Juce_TraceSession::Start(juce::File::getSpecialLocation(juce::File::userDesktopDirectory).getChildFile("imgui_trace.json"));
+//      ImGui_Juce_TraceSession::Stop();
+//  Trace user phases (render thread, within juce::OpenGLRenderer::renderOpenGL()):
+//      {
+//          Juce_ImGuiTrace_Scope("UI");
+//          ImGui::NewFrame();
+//          ...
+//          ImGui::Render();
+//      }
+//      {
+//          Juce_ImGuiTrace_Scope("Render");
+//          ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+//      }
+// Note: Event names must be string literals (or otherwise outlive the session), only the pointer is recorded
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_core/juce_core.h>
+
+#include <atomic>
+
+//==============================================================================
+// Records the enclosing scope as a trace event named i_name
+#define Juce_ImGuiTrace_Scope(i_name) ImGui_Juce_TraceScope const JUCE_JOIN_MACRO(juceImGuiTraceScope_, __LINE__)(i_name)
+
+//==============================================================================
+class ImGui_Juce_TraceSession
+{
+public:
+    ImGui_Juce_TraceSession() = delete;
+
+    //==============================================================================
+    // Starts a session writing to i_traceFile (replacing any existing file). Returns false if the file can't be opened
+    // Events are flushed every i_flushIntervalMs on a background thread, so recording threads never touch the file system
+    static bool Start(juce::File const& i_traceFile
+                    , int i_flushIntervalMs = 250);
+
+    // Flushes the remaining events and completes the file
+    static void Stop();
+
+    static bool IsActive()
+    {
+        return s_active.load(std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // Appends a complete event to the calling thread's buffer. Lock-free, except for the first event recorded on a thread
+    // Events are dropped (and counted) if a thread's buffer fills faster than it's flushed
+    static void RecordEvent(char const* i_name
+                    , juce::int64 i_beginTicks
+                    , juce::int64 i_endTicks);
+
+    // Events dropped in the current / last session
+    static juce::uint64 GetNumEventsDropped();
+
+private:
+    //==============================================================================
+    static std::atomic<bool> s_active;
+};
+
+//==============================================================================
+// See: Juce_ImGuiTrace_Scope()
+class ImGui_Juce_TraceScope
+{
+public:
+    explicit ImGui_Juce_TraceScope(char const* i_name)
+        : m_name(ImGui_Juce_TraceSession::IsActive() ? i_name : nullptr)
+        , m_beginTicks(m_name != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+    {
+    }
+
+    ~ImGui_Juce_TraceScope()
+    {
+        if(m_name != nullptr)
+        {
+            ImGui_Juce_TraceSession::RecordEvent(m_name, m_beginTicks, juce::Time::getHighResolutionTicks());
+        }
+    }
+
+    ImGui_Juce_TraceScope(ImGui_Juce_TraceScope const&) = delete;
+    ImGui_Juce_TraceScope& operator=(ImGui_Juce_TraceScope const&) = delete;
+
+private:
+    char const* m_name;
+    juce::int64 m_beginTicks;
+};
+
+#endif // #ifndef IMGUI_DISABLE
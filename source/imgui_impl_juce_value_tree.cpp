@@ -0,0 +1,633 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Virtualised views over Juce data models for the Juce Platform Backend
+// See imgui_impl_juce_value_tree.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_value_tree.h"
+
+#include <cstring>
+
+//==============================================================================
+namespace JuceImGuiValueTree
+{
+    /**
+     * Note: juce::ValueTree doesn't expose its shared object (the node's identity), though operator== compares exactly that
+     * It is held as the ValueTree's first member (juce::ReferenceCountedObjectPtr, a single pointer), so is read from there
+     * FindNode() checks the result against operator== in debug builds
+     * */
+    static_assert(sizeof(juce::ReferenceCountedObjectPtr<juce::ReferenceCountedObject>) == sizeof(void*));
+
+    static void const* GetNodeIdentity(juce::ValueTree const& i_tree)
+    {
+        void const* nodeIdentity = nullptr;
+        std::memcpy(&nodeIdentity, &i_tree, sizeof(nodeIdentity));
+        return nodeIdentity;
+    }
+
+    static void SnapshotProperty(juce::ValueTree const& i_tree, juce::Identifier const& i_propertyID, juce::var& o_value)
+    {
+        juce::var const* const value = i_tree.getPropertyPointer(i_propertyID);
+        o_value = value != nullptr ? *value : juce::var();
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_DrawClippedRows
+(
+    int const i_numRows
+    , std::function<void(int i_rowIndex)> const& i_drawRowFunction
+)
+{
+    ImGuiListClipper listClipper;
+    listClipper.Begin(i_numRows);
+
+    while(listClipper.Step())
+    {
+        for(int rowIndex = listClipper.DisplayStart; rowIndex < listClipper.DisplayEnd; rowIndex++)
+        {
+            i_drawRowFunction(rowIndex);
+        }
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_DrawListBoxModelRows
+(
+    juce::ListBoxModel& i_listBoxModel
+    , std::function<void(int i_rowIndex)> const& i_drawRowFunction
+)
+{
+    ImGui_Juce_DrawClippedRows(i_listBoxModel.getNumRows(), i_drawRowFunction);
+}
+
+//==============================================================================
+ImGui_Juce_ValueTreeRowIndex::ImGui_Juce_ValueTreeRowIndex
+(
+    juce::ValueTree i_rootTree
+    , juce::Array<juce::Identifier> i_propertyIDs
+    , bool const i_includeRoot /* = false */
+)   : m_rootTree(std::move(i_rootTree))
+    , m_propertyIDs(std::move(i_propertyIDs))
+    , m_includeRoot(i_includeRoot)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    {
+        juce::ScopedLock const lock(m_lock);
+        Rebuild();
+    }
+
+    m_rootTree.addListener(this);
+}
+
+//==============================================================================
+ImGui_Juce_ValueTreeRowIndex::~ImGui_Juce_ValueTreeRowIndex()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    m_rootTree.removeListener(this);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::SetRootTree
+(
+    juce::ValueTree i_rootTree
+)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    // Note: Assigning the listened tree calls valueTreeRedirected(), which rebuilds the rows
+    m_rootTree = std::move(i_rootTree);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::DrawRows
+(
+    DrawRowFunction const& i_drawRowFunction
+)
+{
+    ImGuiListClipper listClipper;
+    listClipper.Begin(GetNumRows());
+
+    while(listClipper.Step())
+    {
+        // Note: Rows removed since Begin() are no longer drawn, the clipper catches up on the next frame
+        CopyRows(listClipper.DisplayStart, listClipper.DisplayEnd, m_drawRows);
+
+        for(size_t i = 0; i < m_drawRows.size(); i++)
+        {
+            i_drawRowFunction(listClipper.DisplayStart + static_cast<int>(i), m_drawRows[i]);
+        }
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::CopyRows
+(
+    int const i_beginRowIndex
+    , int const i_endRowIndex
+    , std::vector<Row>& o_rows
+) const
+{
+    juce::ScopedLock const lock(m_lock);
+
+    int const numRows = static_cast<int>(m_rows.size());
+    int const beginRowIndex = juce::jlimit(0, numRows, i_beginRowIndex);
+    int const endRowIndex = juce::jlimit(beginRowIndex, numRows, i_endRowIndex);
+
+    // Note: Assigning into existing rows reuses their m_values capacity, and juce::var strings are reference counted
+    // So copying the visible rows doesn't allocate in steady state
+    o_rows.resize(static_cast<size_t>(endRowIndex - beginRowIndex));
+    for(int rowIndex = beginRowIndex; rowIndex < endRowIndex; rowIndex++)
+    {
+        o_rows[static_cast<size_t>(rowIndex - beginRowIndex)] = m_rows[static_cast<size_t>(rowIndex)]->m_row;
+    }
+}
+
+//==============================================================================
+bool ImGui_Juce_ValueTreeRowIndex::ConsumeChanges
+(
+    std::vector<int>& o_changedRowIndices
+)
+{
+    juce::ScopedLock const lock(m_lock);
+
+    o_changedRowIndices.clear();
+    for(Node* const node : m_changedNodes)
+    {
+        o_changedRowIndices.push_back(node->m_rowIndex);
+        node->m_changed = false;
+    }
+    m_changedNodes.clear();
+
+    bool const structureChanged = m_structureChanged;
+    m_structureChanged = false;
+
+    return structureChanged;
+}
+
+//==============================================================================
+int ImGui_Juce_ValueTreeRowIndex::GetNumRows() const
+{
+    juce::ScopedLock const lock(m_lock);
+    return static_cast<int>(m_rows.size());
+}
+
+//==============================================================================
+juce::uint32 ImGui_Juce_ValueTreeRowIndex::GetStructureVersion() const
+{
+    juce::ScopedLock const lock(m_lock);
+    return m_structureVersion;
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::valueTreePropertyChanged
+(
+    juce::ValueTree& i_tree
+    , juce::Identifier const& i_property
+)
+{
+    int const propertyIndex = m_propertyIDs.indexOf(i_property);
+    if(propertyIndex < 0)
+    {
+        return; // not snapshotted
+    }
+
+    juce::ScopedLock const lock(m_lock);
+
+    Node* const node = FindNode(i_tree);
+    if(node == nullptr)
+    {
+        return;
+    }
+
+    JuceImGuiValueTree::SnapshotProperty(i_tree, i_property, node->m_row.m_values[static_cast<size_t>(propertyIndex)]);
+    node->m_row.m_version++;
+
+    if(!node->m_changed)
+    {
+        node->m_changed = true;
+        m_changedNodes.push_back(node);
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::valueTreeChildAdded
+(
+    juce::ValueTree& i_parentTree
+    , juce::ValueTree& i_childTree
+)
+{
+    juce::ScopedLock const lock(m_lock);
+
+    int childDepth = 0;
+    int insertRowIndex = GetChildrenBegin(i_parentTree, childDepth);
+    if(insertRowIndex < 0)
+    {
+        return;
+    }
+
+    // Inserted after the preceding sibling's subtree
+    int const childIndex = i_parentTree.indexOf(i_childTree);
+    if(childIndex > 0)
+    {
+        Node* const previousSiblingNode = FindNode(i_parentTree.getChild(childIndex - 1));
+        jassert(previousSiblingNode != nullptr);
+        if(previousSiblingNode != nullptr)
+        {
+            insertRowIndex = GetSubtreeEnd(previousSiblingNode->m_rowIndex);
+        }
+    }
+
+    MarkStructureChanged();
+
+    m_scratchRows.clear();
+    AppendSubtree(i_childTree, childDepth, m_scratchRows);
+    m_rows.insert(m_rows.begin() + insertRowIndex, m_scratchRows.begin(), m_scratchRows.end());
+
+    RenumberRows(insertRowIndex);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::valueTreeChildRemoved
+(
+    [[maybe_unused]] juce::ValueTree& i_parentTree
+    , juce::ValueTree& i_childTree
+    , [[maybe_unused]] int const i_indexFromWhichChildWasRemoved
+)
+{
+    juce::ScopedLock const lock(m_lock);
+
+    Node* const node = FindNode(i_childTree);
+    if(node == nullptr)
+    {
+        return;
+    }
+
+    MarkStructureChanged();
+
+    int const rowIndex = node->m_rowIndex;
+    EraseRows(rowIndex, GetSubtreeEnd(rowIndex));
+
+    RenumberRows(rowIndex);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::valueTreeChildOrderChanged
+(
+    juce::ValueTree& i_parentTree
+    , [[maybe_unused]] int const i_oldIndex
+    , [[maybe_unused]] int const i_newIndex
+)
+{
+    juce::ScopedLock const lock(m_lock);
+
+    int childDepth = 0;
+    int const childrenBegin = GetChildrenBegin(i_parentTree, childDepth);
+    if(childrenBegin < 0)
+    {
+        return;
+    }
+
+    // The parent's descendants end where the next row at (or above) the parent's depth begins
+    int childrenEnd = childrenBegin;
+    while(childrenEnd < static_cast<int>(m_rows.size()) && m_rows[static_cast<size_t>(childrenEnd)]->m_row.m_depth >= childDepth)
+    {
+        childrenEnd++;
+    }
+
+    MarkStructureChanged();
+
+    // Re-ordering the existing nodes (found, not re-created), so snapshots and versions are kept
+    m_scratchRows.clear();
+    for(juce::ValueTree const& childTree : i_parentTree)
+    {
+        AppendSubtree(childTree, childDepth, m_scratchRows);
+    }
+
+    jassert(static_cast<int>(m_scratchRows.size()) == childrenEnd - childrenBegin);
+    m_rows.erase(m_rows.begin() + childrenBegin, m_rows.begin() + childrenEnd);
+    m_rows.insert(m_rows.begin() + childrenBegin, m_scratchRows.begin(), m_scratchRows.end());
+
+    RenumberRows(childrenBegin);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::valueTreeRedirected
+(
+    [[maybe_unused]] juce::ValueTree& i_tree
+)
+{
+    juce::ScopedLock const lock(m_lock);
+
+    Rebuild();
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::Rebuild()
+{
+    MarkStructureChanged();
+
+    m_rows.clear();
+    m_nodes.clear();
+
+    if(m_includeRoot)
+    {
+        AppendSubtree(m_rootTree, 0, m_rows);
+    }
+    else
+    {
+        for(juce::ValueTree const& childTree : m_rootTree)
+        {
+            AppendSubtree(childTree, 0, m_rows);
+        }
+    }
+
+    RenumberRows(0);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::AppendSubtree
+(
+    juce::ValueTree const& i_tree
+    , int const i_depth
+    , std::vector<Node*>& o_rows
+)
+{
+    o_rows.push_back(&FindOrCreateNode(i_tree, i_depth));
+
+    for(juce::ValueTree const& childTree : i_tree)
+    {
+        AppendSubtree(childTree, i_depth + 1, o_rows);
+    }
+}
+
+//==============================================================================
+ImGui_Juce_ValueTreeRowIndex::Node& ImGui_Juce_ValueTreeRowIndex::FindOrCreateNode
+(
+    juce::ValueTree const& i_tree
+    , int const i_depth
+)
+{
+    auto const [nodeIterator, inserted] = m_nodes.try_emplace(JuceImGuiValueTree::GetNodeIdentity(i_tree));
+    Node& node = nodeIterator->second;
+
+    if(inserted)
+    {
+        node.m_tree = i_tree;
+        node.m_row.m_type = i_tree.getType();
+        node.m_row.m_values.resize(static_cast<size_t>(m_propertyIDs.size()));
+
+        for(int propertyIndex = 0; propertyIndex < m_propertyIDs.size(); propertyIndex++)
+        {
+            JuceImGuiValueTree::SnapshotProperty(i_tree, m_propertyIDs.getReference(propertyIndex), node.m_row.m_values[static_cast<size_t>(propertyIndex)]);
+        }
+    }
+
+    jassert(node.m_tree == i_tree);
+    node.m_row.m_depth = i_depth;
+
+    return node;
+}
+
+//==============================================================================
+ImGui_Juce_ValueTreeRowIndex::Node* ImGui_Juce_ValueTreeRowIndex::FindNode
+(
+    juce::ValueTree const& i_tree
+)
+{
+    auto const nodeIterator = m_nodes.find(JuceImGuiValueTree::GetNodeIdentity(i_tree));
+    if(nodeIterator == m_nodes.end())
+    {
+        return nullptr;
+    }
+
+    // Note: The identity read must agree with juce::ValueTree::operator== (See: JuceImGuiValueTree::GetNodeIdentity())
+    jassert(nodeIterator->second.m_tree == i_tree);
+    return &nodeIterator->second;
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::EraseRows
+(
+    int const i_beginRowIndex
+    , int const i_endRowIndex
+)
+{
+    for(int rowIndex = i_beginRowIndex; rowIndex < i_endRowIndex; rowIndex++)
+    {
+        m_nodes.erase(JuceImGuiValueTree::GetNodeIdentity(m_rows[static_cast<size_t>(rowIndex)]->m_tree));
+    }
+
+    m_rows.erase(m_rows.begin() + i_beginRowIndex, m_rows.begin() + i_endRowIndex);
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::RenumberRows
+(
+    int const i_beginRowIndex
+)
+{
+    for(size_t rowIndex = static_cast<size_t>(i_beginRowIndex); rowIndex < m_rows.size(); rowIndex++)
+    {
+        m_rows[rowIndex]->m_rowIndex = static_cast<int>(rowIndex);
+    }
+}
+
+//==============================================================================
+int ImGui_Juce_ValueTreeRowIndex::GetSubtreeEnd
+(
+    int const i_rowIndex
+) const
+{
+    int const numRows = static_cast<int>(m_rows.size());
+    int const depth = m_rows[static_cast<size_t>(i_rowIndex)]->m_row.m_depth;
+
+    int subtreeEnd = i_rowIndex + 1;
+    while(subtreeEnd < numRows && m_rows[static_cast<size_t>(subtreeEnd)]->m_row.m_depth > depth)
+    {
+        subtreeEnd++;
+    }
+
+    return subtreeEnd;
+}
+
+//==============================================================================
+int ImGui_Juce_ValueTreeRowIndex::GetChildrenBegin
+(
+    juce::ValueTree const& i_parentTree
+    , int& o_childDepth
+)
+{
+    if(i_parentTree == m_rootTree)
+    {
+        o_childDepth = m_includeRoot ? 1 : 0;
+        return m_includeRoot ? 1 : 0;
+    }
+
+    Node* const parentNode = FindNode(i_parentTree);
+    if(parentNode == nullptr)
+    {
+        return -1;
+    }
+
+    o_childDepth = parentNode->m_row.m_depth + 1;
+    return parentNode->m_rowIndex + 1;
+}
+
+//==============================================================================
+void ImGui_Juce_ValueTreeRowIndex::MarkStructureChanged()
+{
+    // Row indices are about to shift, so the recorded changed rows are meaningless: consumers refresh everything
+    // Note: Called before the change, while every recorded node still exists (See: EraseRows())
+    m_structureVersion++;
+    m_structureChanged = true;
+
+    for(Node* const node : m_changedNodes)
+    {
+        node->m_changed = false;
+    }
+    m_changedNodes.clear();
+}
+
+#if JUCE_UNIT_TESTS
+//==============================================================================
+// Checks the incremental listener paths against a full Rebuild() (a freshly constructed index over the same tree)
+class ImGui_Juce_ValueTreeRowIndexTests : public juce::UnitTest
+{
+public:
+    ImGui_Juce_ValueTreeRowIndexTests()
+        : juce::UnitTest("ImGui_Juce_ValueTreeRowIndex", "ImGui_Juce")
+    {
+    }
+
+    void runTest() override
+    {
+        for(bool const includeRoot : { false, true })
+        {
+            juce::String const suffix = includeRoot ? " (root included)" : "";
+
+            juce::ValueTree rootTree = CreateNode("session", "root", 3, 2);
+            ImGui_Juce_ValueTreeRowIndex rowIndex(rootTree, GetPropertyIDs(), includeRoot);
+            std::vector<int> changedRowIndices;
+
+            beginTest("Construction" + suffix);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+
+            beginTest("Add" + suffix);
+            rootTree.appendChild(CreateNode("track", "last", 2, 1), nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            rootTree.addChild(CreateNode("track", "first", 0, 0), 0, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            rootTree.getChild(2).addChild(CreateNode("clip", "nested", 2, 2), 1, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+
+            beginTest("Property changes" + suffix);
+            rowIndex.ConsumeChanges(changedRowIndices);
+            juce::ValueTree changedTree = rootTree.getChild(2).getChild(1);
+            changedTree.setProperty("name", "renamed", nullptr);
+            changedTree.setProperty("name", "renamed again", nullptr);
+            changedTree.setProperty("unviewed", 1, nullptr);
+            expect(!rowIndex.ConsumeChanges(changedRowIndices));
+            expectEquals(static_cast<int>(changedRowIndices.size()), 1);
+            if(changedRowIndices.size() == 1)
+            {
+                std::vector<ImGui_Juce_ValueTreeRowIndex::Row> changedRows;
+                rowIndex.CopyRows(changedRowIndices[0], changedRowIndices[0] + 1, changedRows);
+                expect(changedRows.size() == 1 && changedRows[0].m_values[0] == juce::var("renamed again"));
+            }
+            changedTree.removeProperty("gain", nullptr);
+            rootTree.setProperty("name", "root renamed", nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+
+            beginTest("Remove" + suffix);
+            rootTree.getChild(2).removeChild(1, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            rootTree.removeChild(0, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            expect(rowIndex.ConsumeChanges(changedRowIndices));
+            expect(changedRowIndices.empty());
+
+            beginTest("Move" + suffix);
+            rootTree.moveChild(0, rootTree.getNumChildren() - 1, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            rootTree.getChild(1).moveChild(1, 0, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+            juce::ValueTree movedTree = rootTree.getChild(0).getChild(0);
+            rootTree.getChild(0).removeChild(movedTree, nullptr);
+            rootTree.getChild(1).addChild(movedTree, 1, nullptr);
+            ExpectMatchesRebuild(rowIndex, rootTree, includeRoot);
+
+            beginTest("Redirect" + suffix);
+            juce::ValueTree otherRootTree = CreateNode("session", "other", 2, 3);
+            rowIndex.SetRootTree(otherRootTree);
+            ExpectMatchesRebuild(rowIndex, otherRootTree, includeRoot);
+            rootTree.appendChild(CreateNode("track", "previous root", 1, 1), nullptr);
+            otherRootTree.getChild(1).appendChild(CreateNode("clip", "after redirect", 1, 0), nullptr);
+            ExpectMatchesRebuild(rowIndex, otherRootTree, includeRoot);
+        }
+    }
+
+private:
+    //==============================================================================
+    static juce::Array<juce::Identifier> GetPropertyIDs()
+    {
+        return { "name", "gain" };
+    }
+
+    static juce::ValueTree CreateNode
+    (
+        juce::Identifier const& i_type
+        , juce::String const& i_name
+        , int const i_numChildren
+        , int const i_numGrandchildren
+    )
+    {
+        juce::ValueTree tree(i_type);
+        tree.setProperty("name", i_name, nullptr);
+        tree.setProperty("gain", i_name.length() * 0.5, nullptr);
+
+        for(int i = 0; i < i_numChildren; i++)
+        {
+            tree.appendChild(CreateNode("child", i_name + "." + juce::String(i), i_numGrandchildren, 0), nullptr);
+        }
+
+        return tree;
+    }
+
+    void ExpectMatchesRebuild
+    (
+        ImGui_Juce_ValueTreeRowIndex const& i_rowIndex
+        , juce::ValueTree const& i_rootTree
+        , bool const i_includeRoot
+    )
+    {
+        ImGui_Juce_ValueTreeRowIndex const rebuiltRowIndex(i_rootTree, GetPropertyIDs(), i_includeRoot);
+
+        std::vector<ImGui_Juce_ValueTreeRowIndex::Row> rows;
+        std::vector<ImGui_Juce_ValueTreeRowIndex::Row> rebuiltRows;
+        i_rowIndex.CopyRows(0, i_rowIndex.GetNumRows(), rows);
+        rebuiltRowIndex.CopyRows(0, rebuiltRowIndex.GetNumRows(), rebuiltRows);
+
+        expectEquals(static_cast<int>(rows.size()), static_cast<int>(rebuiltRows.size()));
+
+        for(size_t i = 0; i < juce::jmin(rows.size(), rebuiltRows.size()); i++)
+        {
+            expect(rows[i].m_type == rebuiltRows[i].m_type, "Row " + juce::String(i) + " type");
+            expectEquals(rows[i].m_depth, rebuiltRows[i].m_depth, "Row " + juce::String(i) + " depth");
+            expect(rows[i].m_values == rebuiltRows[i].m_values, "Row " + juce::String(i) + " values");
+        }
+    }
+};
+
+static ImGui_Juce_ValueTreeRowIndexTests s_valueTreeRowIndexTests;
+#endif // JUCE_UNIT_TESTS
+
+#endif // #ifndef IMGUI_DISABLE
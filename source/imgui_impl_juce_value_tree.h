@@ -0,0 +1,159 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Virtualised views over Juce data models for the Juce Platform Backend
+// Draws juce::ValueTree / juce::ListBoxModel rows with ImGuiListClipper (also within tables)
+
+// ImGui_Juce_ValueTreeRowIndex:
+// A flat (depth first) row index over a juce::ValueTree, updated incrementally via juce::ValueTree::Listener callbacks
+// Each row snapshots only the properties the view draws. Property changes are recorded per row (See: ConsumeChanges())
+
+// Usage (construction on the message thread):
+//  m_sessionRowIndex = std::make_unique<ImGui_Juce_ValueTreeRowIndex>(m_sessionTree, juce::Array<juce::Identifier> { "name", "gain" });
+// Render thread, inside an ImGui window or between ImGui::BeginTable() / ImGui::EndTable():
+//  m_sessionRowIndex->DrawRows([](int i_rowIndex, ImGui_Juce_ValueTreeRowIndex::Row const& i_row)
+//  {
+//      ImGui::TableNextRow();
+//      ImGui::TableNextColumn();
+//      ImGui::Indent(i_row.m_depth * 10.0f);
+//      ImGui::TextUnformatted(i_row.m_type.toString().toRawUTF8());
+//      ImGui::TextUnformatted(i_row.m_values[0].toString().toRawUTF8()); // "name"
+//      ...
+//  });
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_data_structures/juce_data_structures.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+//==============================================================================
+// Draws rows [0, i_numRows) with ImGuiListClipper, i.e. only calling i_drawRowFunction for the visible rows
+// Rows must be of equal height. Usable within ImGui::BeginTable() (call ImGui::TableNextRow() within i_drawRowFunction)
+void ImGui_Juce_DrawClippedRows(int i_numRows
+                    , std::function<void(int i_rowIndex)> const& i_drawRowFunction);
+
+//==============================================================================
+// Virtualised view over a juce::ListBoxModel, e.g. an existing Juce list model shared with juce::ListBox
+// Note: juce::ListBoxModel::getNumRows() is called on the render thread, so must be thread safe
+void ImGui_Juce_DrawListBoxModelRows(juce::ListBoxModel& i_listBoxModel
+                    , std::function<void(int i_rowIndex)> const& i_drawRowFunction);
+
+//==============================================================================
+class ImGui_Juce_ValueTreeRowIndex  : private juce::ValueTree::Listener
+{
+public:
+    // A snapshot of a node, updated from the listener callbacks (message thread), so drawing never reads the live juce::ValueTree
+    struct Row
+    {
+        juce::Identifier m_type;
+        std::vector<juce::var> m_values;    // Parallel to the index's property IDs (void where the node lacks the property)
+                                            // Note: juce::var arrays / objects are shared with the tree, not deep copied
+        int m_depth = 0;                    // 0 for the root's children (or the root itself, when included)
+        juce::uint32 m_version = 0;         // Incremented when one of this node's snapshotted properties changes
+    };
+
+    using DrawRowFunction = std::function<void(int i_rowIndex, Row const& i_row)>;
+
+    // i_propertyIDs: the properties snapshotted per row (See: Row::m_values), changes to other properties are ignored
+    // Note: Must be constructed / destroyed on the main thread (Juce message thread), as it registers as a juce::ValueTree::Listener
+    ImGui_Juce_ValueTreeRowIndex(juce::ValueTree i_rootTree
+                            , juce::Array<juce::Identifier> i_propertyIDs
+                            , bool i_includeRoot = false);
+    ~ImGui_Juce_ValueTreeRowIndex() override;
+    ImGui_Juce_ValueTreeRowIndex(ImGui_Juce_ValueTreeRowIndex const&) = delete;
+
+    ImGui_Juce_ValueTreeRowIndex& operator=(ImGui_Juce_ValueTreeRowIndex const&) = delete;
+    bool operator==(ImGui_Juce_ValueTreeRowIndex const&) = delete;
+    bool operator!=(ImGui_Juce_ValueTreeRowIndex const&) = delete;
+
+    //==============================================================================
+    // Re-targets the index to another tree (e.g. a newly loaded session), rebuilding all rows. Main thread (Juce message thread)
+    void SetRootTree(juce::ValueTree i_rootTree);
+
+    //==============================================================================
+    // Draws only the visible rows (See: ImGui_Juce_DrawClippedRows()). Render thread
+    // Note: The visible rows are copied under the index's lock, then drawn without it, so listener callbacks never wait on drawing
+    // Rows are snapshots: row callbacks must not access the (not thread safe) juce::ValueTree itself
+    void DrawRows(DrawRowFunction const& i_drawRowFunction);
+
+    // Copies rows [i_beginRowIndex, i_endRowIndex) (clamped to the current rows) into o_rows, reusing its capacity
+    void CopyRows(int i_beginRowIndex, int i_endRowIndex, std::vector<Row>& o_rows) const;
+
+    //==============================================================================
+    // Retrieves the rows whose properties changed since the last call (each row at most once)
+    // Returns true if the structure changed (rows added / removed / moved), in which case all row indices should be considered changed
+    bool ConsumeChanges(std::vector<int>& o_changedRowIndices);
+
+    int GetNumRows() const;
+
+    // Incremented on every structural change, e.g. to invalidate per-row UI caches keyed by row index
+    juce::uint32 GetStructureVersion() const;
+
+private:
+    //==============================================================================
+    // juce::ValueTree::Listener overrides: juce/modules/juce_data_structures/values/juce_ValueTree.h
+    void valueTreePropertyChanged(juce::ValueTree& i_tree
+                                , juce::Identifier const& i_property) override;
+    void valueTreeChildAdded(juce::ValueTree& i_parentTree
+                                , juce::ValueTree& i_childTree) override;
+    void valueTreeChildRemoved(juce::ValueTree& i_parentTree
+                                , juce::ValueTree& i_childTree
+                                , int i_indexFromWhichChildWasRemoved) override;
+    void valueTreeChildOrderChanged(juce::ValueTree& i_parentTree
+                                , int i_oldIndex
+                                , int i_newIndex) override;
+    void valueTreeRedirected(juce::ValueTree& i_tree) override;
+
+    //==============================================================================
+    // The indexed node (message thread only) and its snapshot (copied for drawing on the render thread)
+    // Note: Nodes are owned by m_nodes (stable addresses), rows only order them, so structural changes shift pointers
+    struct Node
+    {
+        juce::ValueTree m_tree;
+        Row m_row;
+        int m_rowIndex = 0;
+        bool m_changed = false;             // dedupes m_changedNodes
+    };
+
+    //==============================================================================
+    // Note: The following are called with m_lock held
+    void Rebuild();
+    void AppendSubtree(juce::ValueTree const& i_tree, int i_depth, std::vector<Node*>& o_rows);
+    Node& FindOrCreateNode(juce::ValueTree const& i_tree, int i_depth);
+    Node* FindNode(juce::ValueTree const& i_tree);  // nullptr if not indexed (the excluded root or not a descendant)
+    void EraseRows(int i_beginRowIndex, int i_endRowIndex);
+    void RenumberRows(int i_beginRowIndex);
+    int GetSubtreeEnd(int i_rowIndex) const;        // One past the row's last descendant
+    int GetChildrenBegin(juce::ValueTree const& i_parentTree, int& o_childDepth); // First child row of the parent (or root)
+    void MarkStructureChanged();                    // Before each structural change
+
+    //==============================================================================
+    // Constructor initialisation order:
+    juce::ValueTree m_rootTree;
+    juce::Array<juce::Identifier> const m_propertyIDs;
+    bool m_includeRoot;
+
+    //==============================================================================
+    juce::CriticalSection m_lock;
+    std::unordered_map<void const*, Node> m_nodes;  // Keyed by the node's shared object (See: JuceImGuiValueTree::GetNodeIdentity())
+    std::vector<Node*> m_rows;
+    std::vector<Node*> m_scratchRows;       // reused when inserting / reordering subtrees
+    std::vector<Node*> m_changedNodes;
+    juce::uint32 m_structureVersion = 0;
+    bool m_structureChanged = true;
+
+    //==============================================================================
+    std::vector<Row> m_drawRows;            // Render thread only. See: DrawRows()
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,450 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Multi-resolution waveform summary + widget for the Juce Platform Backend
+// See imgui_impl_juce_waveform.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_waveform.h"
+
+#include <cmath>
+#include <limits>
+
+//==============================================================================
+namespace JuceImGuiWaveform
+{
+    // Four independent accumulators, so the compiler can vectorise the loop without -ffast-math (no float add reassociation needed)
+    static float GetSumOfSquares(float const* const i_samples, int const i_numSamples)
+    {
+        float sums[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        int i = 0;
+        for(; i + 4 <= i_numSamples; i += 4)
+        {
+            sums[0] += i_samples[i + 0] * i_samples[i + 0];
+            sums[1] += i_samples[i + 1] * i_samples[i + 1];
+            sums[2] += i_samples[i + 2] * i_samples[i + 2];
+            sums[3] += i_samples[i + 3] * i_samples[i + 3];
+        }
+
+        for(; i < i_numSamples; i++)
+        {
+            sums[0] += i_samples[i] * i_samples[i];
+        }
+
+        return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    }
+
+    // Note: With 16-bit ImDrawIdx, a single PrimReserve() must stay below 65536 vertices (2 rects, 8 vertices per column)
+    static constexpr int s_maxColumnsPerReserve = (1 << 16) / 8 - 1;
+}
+
+//==============================================================================
+ImGui_Juce_WaveformSummary::ImGui_Juce_WaveformSummary
+(
+    juce::AudioFormatManager& i_audioFormatManager
+    , juce::File const& i_audioFile
+)   : juce::Thread("ImGui_Juce_WaveformSummary")
+{
+    // Prefer memory-mapped readers: pages are read on demand and reclaimable by the OS, rather than the file being loaded
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> mappedReader(i_audioFormatManager.createMemoryMappedReader(i_audioFile));
+    if(mappedReader != nullptr && mappedReader->mapEntireFile())
+    {
+        m_buildReader = std::move(mappedReader);
+
+        m_rawReader.reset(i_audioFormatManager.createMemoryMappedReader(i_audioFile));
+        if(m_rawReader != nullptr && (!m_rawReader->mapEntireFile() || static_cast<int>(m_rawReader->numChannels) > s_maxRawChannels))
+        {
+            m_rawReader.reset();
+        }
+    }
+    else
+    {
+        m_buildReader.reset(i_audioFormatManager.createReaderFor(i_audioFile));
+    }
+
+    if(m_buildReader == nullptr || m_buildReader->lengthInSamples <= 0 || m_buildReader->numChannels <= 0)
+    {
+        m_buildReader.reset();
+        m_rawReader.reset();
+        return;
+    }
+
+    m_numChannels = static_cast<int>(m_buildReader->numChannels);
+    m_lengthInSamples = m_buildReader->lengthInSamples;
+    m_sampleRate = m_buildReader->sampleRate;
+
+    // All levels are allocated upfront, so the render thread can read built bins while later bins are written
+    juce::int64 samplesPerBin = s_baseSamplesPerBin;
+    juce::int64 numBins = (m_lengthInSamples + samplesPerBin - 1) / samplesPerBin;
+    while(true)
+    {
+        std::unique_ptr<Level> level = std::make_unique<Level>();
+        level->m_samplesPerBin = samplesPerBin;
+        level->m_numBins = numBins;
+        level->m_bins.resize(static_cast<size_t>(numBins * m_numChannels));
+        m_levels.push_back(std::move(level));
+
+        if(numBins <= 1)
+        {
+            break;
+        }
+
+        samplesPerBin *= s_levelFactor;
+        numBins = (numBins + s_levelFactor - 1) / s_levelFactor;
+    }
+
+    startThread(juce::Thread::Priority::low);
+}
+
+//==============================================================================
+ImGui_Juce_WaveformSummary::~ImGui_Juce_WaveformSummary()
+{
+    stopThread(2000);
+}
+
+//==============================================================================
+bool ImGui_Juce_WaveformSummary::IsValid() const
+{
+    return !m_levels.empty();
+}
+
+//==============================================================================
+bool ImGui_Juce_WaveformSummary::IsBuilt() const
+{
+    return IsValid() && m_levels.back()->m_numBinsReady.load(std::memory_order_acquire) == m_levels.back()->m_numBins;
+}
+
+//==============================================================================
+float ImGui_Juce_WaveformSummary::GetBuildProgress() const
+{
+    if(!IsValid())
+    {
+        return 0.0f;
+    }
+
+    Level const& baseLevel = *m_levels.front();
+    return static_cast<float>(static_cast<double>(baseLevel.m_numBinsReady.load(std::memory_order_relaxed)) / static_cast<double>(baseLevel.m_numBins));
+}
+
+//==============================================================================
+int ImGui_Juce_WaveformSummary::GetNumChannels() const
+{
+    return m_numChannels;
+}
+
+//==============================================================================
+juce::int64 ImGui_Juce_WaveformSummary::GetLengthInSamples() const
+{
+    return m_lengthInSamples;
+}
+
+//==============================================================================
+double ImGui_Juce_WaveformSummary::GetSampleRate() const
+{
+    return m_sampleRate;
+}
+
+//==============================================================================
+bool ImGui_Juce_WaveformSummary::GetRange
+(
+    int const i_channel
+    , juce::int64 i_startSample
+    , juce::int64 i_endSample
+    , double const i_samplesPerBin
+    , Bin& o_bin
+) const
+{
+    if(!IsValid() || !juce::isPositiveAndBelow(i_channel, m_numChannels))
+    {
+        return false;
+    }
+
+    i_startSample = juce::jmax(i_startSample, juce::int64(0));
+    i_endSample = juce::jmin(i_endSample, m_lengthInSamples);
+    if(i_endSample <= i_startSample)
+    {
+        return false;
+    }
+
+    if(i_samplesPerBin < s_baseSamplesPerBin && m_rawReader != nullptr)
+    {
+        return GetRawRange(i_channel, i_startSample, i_endSample, o_bin);
+    }
+
+    Level const& level = *m_levels[static_cast<size_t>(FindLevel(i_samplesPerBin))];
+    juce::int64 const numBinsReady = level.m_numBinsReady.load(std::memory_order_acquire);
+    juce::int64 const firstBin = i_startSample / level.m_samplesPerBin;
+    juce::int64 const endBin = juce::jmin((i_endSample + level.m_samplesPerBin - 1) / level.m_samplesPerBin, numBinsReady);
+    if(endBin <= firstBin)
+    {
+        return false;
+    }
+
+    float minimum = std::numeric_limits<float>::max();
+    float maximum = std::numeric_limits<float>::lowest();
+    float sumOfSquares = 0.0f;
+
+    for(juce::int64 binIndex = firstBin; binIndex < endBin; ++binIndex)
+    {
+        Bin const& bin = level.m_bins[static_cast<size_t>(binIndex * m_numChannels + i_channel)];
+        minimum = juce::jmin(minimum, bin.m_min);
+        maximum = juce::jmax(maximum, bin.m_max);
+        sumOfSquares += bin.m_rms * bin.m_rms;
+    }
+
+    o_bin = Bin { minimum, maximum, std::sqrt(sumOfSquares / static_cast<float>(endBin - firstBin)) };
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_WaveformSummary::run()
+{
+    juce::AudioBuffer<float> block(m_numChannels, s_blockSize);
+
+    for(juce::int64 startSample = 0; startSample < m_lengthInSamples; startSample += s_blockSize)
+    {
+        if(threadShouldExit())
+        {
+            return;
+        }
+
+        int const numSamples = static_cast<int>(juce::jmin(juce::int64(s_blockSize), m_lengthInSamples - startSample));
+        if(!m_buildReader->read(&block, 0, numSamples, startSample, true, true))
+        {
+            // Read errors leave the remaining summary unbuilt (drawn empty)
+            return;
+        }
+
+        BuildBaseBins(block, numSamples, startSample / s_baseSamplesPerBin);
+        BuildParentBins(startSample + numSamples >= m_lengthInSamples);
+    }
+
+    // The build reader's mapping is no longer needed
+    m_buildReader.reset();
+}
+
+//==============================================================================
+void ImGui_Juce_WaveformSummary::BuildBaseBins
+(
+    juce::AudioBuffer<float> const& i_block
+    , int const i_numSamples
+    , juce::int64 const i_firstBin
+)
+{
+    Level& baseLevel = *m_levels.front();
+    int const numBins = (i_numSamples + s_baseSamplesPerBin - 1) / s_baseSamplesPerBin;
+
+    for(int binIndex = 0; binIndex < numBins; ++binIndex)
+    {
+        int const binStartSample = binIndex * s_baseSamplesPerBin;
+        int const binNumSamples = juce::jmin(s_baseSamplesPerBin, i_numSamples - binStartSample);
+
+        for(int channel = 0; channel < m_numChannels; ++channel)
+        {
+            float const* const samples = i_block.getReadPointer(channel, binStartSample);
+
+            // Note: SIMD min / max reduction
+            juce::Range<float> const minMax = juce::FloatVectorOperations::findMinAndMax(samples, binNumSamples);
+            float const rms = std::sqrt(JuceImGuiWaveform::GetSumOfSquares(samples, binNumSamples) / static_cast<float>(binNumSamples));
+
+            baseLevel.m_bins[static_cast<size_t>((i_firstBin + binIndex) * m_numChannels + channel)] = Bin { minMax.getStart(), minMax.getEnd(), rms };
+        }
+    }
+
+    baseLevel.m_numBinsReady.store(i_firstBin + numBins, std::memory_order_release);
+}
+
+//==============================================================================
+void ImGui_Juce_WaveformSummary::BuildParentBins
+(
+    bool const i_isFinalBlock
+)
+{
+    for(size_t levelIndex = 1; levelIndex < m_levels.size(); ++levelIndex)
+    {
+        Level const& childLevel = *m_levels[levelIndex - 1];
+        Level& level = *m_levels[levelIndex];
+
+        // Only the builder thread writes, so relaxed loads of its own progress
+        juce::int64 const numChildBinsReady = childLevel.m_numBinsReady.load(std::memory_order_relaxed);
+        juce::int64 const numBinsReady = level.m_numBinsReady.load(std::memory_order_relaxed);
+
+        // A parent bin is built once all its children are (the last parent may have fewer children)
+        juce::int64 const numBinsToBuild = i_isFinalBlock ? level.m_numBins : numChildBinsReady / s_levelFactor;
+
+        for(juce::int64 binIndex = numBinsReady; binIndex < numBinsToBuild; ++binIndex)
+        {
+            juce::int64 const firstChild = binIndex * s_levelFactor;
+            juce::int64 const endChild = juce::jmin(firstChild + s_levelFactor, numChildBinsReady);
+
+            for(int channel = 0; channel < m_numChannels; ++channel)
+            {
+                Bin bin = childLevel.m_bins[static_cast<size_t>(firstChild * m_numChannels + channel)];
+                float sumOfSquares = bin.m_rms * bin.m_rms;
+
+                for(juce::int64 childIndex = firstChild + 1; childIndex < endChild; ++childIndex)
+                {
+                    Bin const& childBin = childLevel.m_bins[static_cast<size_t>(childIndex * m_numChannels + channel)];
+                    bin.m_min = juce::jmin(bin.m_min, childBin.m_min);
+                    bin.m_max = juce::jmax(bin.m_max, childBin.m_max);
+                    sumOfSquares += childBin.m_rms * childBin.m_rms;
+                }
+
+                bin.m_rms = std::sqrt(sumOfSquares / static_cast<float>(endChild - firstChild));
+                level.m_bins[static_cast<size_t>(binIndex * m_numChannels + channel)] = bin;
+            }
+        }
+
+        if(numBinsToBuild > numBinsReady)
+        {
+            level.m_numBinsReady.store(numBinsToBuild, std::memory_order_release);
+        }
+    }
+}
+
+//==============================================================================
+int ImGui_Juce_WaveformSummary::FindLevel
+(
+    double const i_samplesPerBin
+) const
+{
+    // The coarsest level which still has at least one bin per pixel column
+    int levelIndex = 0;
+    while(levelIndex + 1 < static_cast<int>(m_levels.size())
+        && static_cast<double>(m_levels[static_cast<size_t>(levelIndex + 1)]->m_samplesPerBin) <= i_samplesPerBin)
+    {
+        ++levelIndex;
+    }
+
+    return levelIndex;
+}
+
+//==============================================================================
+bool ImGui_Juce_WaveformSummary::GetRawRange
+(
+    int const i_channel
+    , juce::int64 const i_startSample
+    , juce::int64 const i_endSample
+    , Bin& o_bin
+) const
+{
+    // Block reads of the requested channel only (other channels' pointers are nullptr, so skipped)
+    // Rather than a virtual getSample() call per sample. Columns below level 0 span fewer than s_baseSamplesPerBin samples
+    float samples[s_baseSamplesPerBin];
+    float* destChannels[s_maxRawChannels] = {};
+    destChannels[i_channel] = samples;
+
+    float minimum = std::numeric_limits<float>::max();
+    float maximum = std::numeric_limits<float>::lowest();
+    float sumOfSquares = 0.0f;
+
+    for(juce::int64 startSample = i_startSample; startSample < i_endSample; startSample += s_baseSamplesPerBin)
+    {
+        int const numSamples = static_cast<int>(juce::jmin(juce::int64(s_baseSamplesPerBin), i_endSample - startSample));
+        if(!m_rawReader->read(destChannels, i_channel + 1, startSample, numSamples))
+        {
+            return false;
+        }
+
+        juce::Range<float> const minMax = juce::FloatVectorOperations::findMinAndMax(samples, numSamples);
+        minimum = juce::jmin(minimum, minMax.getStart());
+        maximum = juce::jmax(maximum, minMax.getEnd());
+        sumOfSquares += JuceImGuiWaveform::GetSumOfSquares(samples, numSamples);
+    }
+
+    o_bin = Bin { minimum, maximum, std::sqrt(sumOfSquares / static_cast<float>(i_endSample - i_startSample)) };
+    return true;
+}
+
+//==============================================================================
+bool ImGui_Juce_Waveform
+(
+    char const* const i_label
+    , ImGui_Juce_WaveformSummary const& i_waveformSummary
+    , int const i_channel
+    , double const i_viewStartSample
+    , double const i_viewEndSample
+    , ImVec2 const i_size
+)
+{
+    ImVec2 const availableSize = ImGui::GetContentRegionAvail();
+    ImVec2 const size(i_size.x <= 0.0f ? juce::jmax(availableSize.x, 1.0f) : i_size.x
+                    , i_size.y <= 0.0f ? juce::jmax(availableSize.y, 1.0f) : i_size.y);
+
+    bool const isPressed = ImGui::InvisibleButton(i_label, size);
+
+    ImDrawList& drawList = *ImGui::GetWindowDrawList();
+    ImVec2 const rectMin = ImGui::GetItemRectMin();
+    ImVec2 const rectMax = ImGui::GetItemRectMax();
+    drawList.AddRectFilled(rectMin, rectMax, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+    if(!ImGui::IsItemVisible() || i_viewEndSample <= i_viewStartSample)
+    {
+        return isPressed;
+    }
+
+    // One column per framebuffer pixel, so the draw cost depends on the widget's width, not the file length
+    float const renderingScale = ImGui::GetIO().DisplayFramebufferScale.x;
+    int const numColumns = juce::jmax(1, static_cast<int>(size.x * renderingScale));
+    float const columnWidth = size.x / static_cast<float>(numColumns);
+    double const samplesPerColumn = (i_viewEndSample - i_viewStartSample) / static_cast<double>(numColumns);
+
+    float const centreY = (rectMin.y + rectMax.y) * 0.5f;
+    float const halfHeight = (rectMax.y - rectMin.y) * 0.5f;
+    auto const getY = [centreY, halfHeight](float const i_value)
+    {
+        return centreY - juce::jlimit(-1.0f, 1.0f, i_value) * halfHeight;
+    };
+
+    ImU32 const peakColour = ImGui::GetColorU32(ImGuiCol_PlotLines);
+    ImU32 const rmsColour = ImGui::GetColorU32(ImGuiCol_PlotLinesHovered);
+
+    for(int batchBegin = 0; batchBegin < numColumns; batchBegin += JuceImGuiWaveform::s_maxColumnsPerReserve)
+    {
+        int const batchEnd = juce::jmin(numColumns, batchBegin + JuceImGuiWaveform::s_maxColumnsPerReserve);
+
+        // Two rects (peak, RMS) per column, unused reservations are returned below
+        drawList.PrimReserve((batchEnd - batchBegin) * 12, (batchEnd - batchBegin) * 8);
+        int numColumnsDrawn = 0;
+
+        for(int column = batchBegin; column < batchEnd; ++column)
+        {
+            double const columnStartSample = i_viewStartSample + samplesPerColumn * column;
+            juce::int64 const startSample = static_cast<juce::int64>(std::floor(columnStartSample));
+            juce::int64 const endSample = juce::jmax(startSample + 1, static_cast<juce::int64>(std::floor(columnStartSample + samplesPerColumn)));
+
+            ImGui_Juce_WaveformSummary::Bin bin;
+            if(!i_waveformSummary.GetRange(i_channel, startSample, endSample, samplesPerColumn, bin))
+            {
+                continue;
+            }
+
+            float const x0 = rectMin.x + columnWidth * static_cast<float>(column);
+            float const x1 = x0 + columnWidth;
+
+            // Note: At least one framebuffer pixel high, so silence / zoomed in samples stay visible
+            float const minimumHeight = 1.0f / renderingScale;
+            float const peakTop = getY(bin.m_max);
+            float const peakBottom = juce::jmax(getY(bin.m_min), peakTop + minimumHeight);
+            drawList.PrimRect(ImVec2(x0, peakTop), ImVec2(x1, peakBottom), peakColour);
+
+            float const rms = juce::jmin(bin.m_rms, juce::jmax(bin.m_max, -bin.m_min));
+            drawList.PrimRect(ImVec2(x0, getY(rms)), ImVec2(x1, juce::jmax(getY(-rms), getY(rms) + minimumHeight)), rmsColour);
+
+            ++numColumnsDrawn;
+        }
+
+        int const numColumnsUnused = (batchEnd - batchBegin) - numColumnsDrawn;
+        drawList.PrimUnreserve(numColumnsUnused * 12, numColumnsUnused * 8);
+    }
+
+    return isPressed;
+}
+
+#endif // #ifndef IMGUI_DISABLE
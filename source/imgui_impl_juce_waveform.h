@@ -0,0 +1,118 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Multi-resolution waveform summary + widget for the Juce Platform Backend
+// A min / max / RMS pyramid is built once on a background thread, streamed from a memory-mapped reader (WAV / AIFF)
+// Level 0 summarises s_baseSamplesPerBin samples per bin, each following level s_levelFactor bins of the previous level
+// Each frame the widget reads only the level matching its samples per pixel (at most s_levelFactor bins per pixel)
+// Note: Zoomed in below level 0, samples are block read from the memory-mapped file
+
+// Usage:
+//  Message thread, e.g. on file load (the summary builds in the background, and can be drawn while building):
+//      m_waveformSummary = std::make_unique<ImGui_Juce_WaveformSummary>(m_audioFormatManager, audioFile);
+//  Render thread, within the ImGui frame:
+//      ImGui_Juce_Waveform("##waveform", *m_waveformSummary, 0, m_viewStartSample, m_viewEndSample, ImVec2(-1.0f, 120.0f));
+
+// Note: Formats without memory-mapped support are streamed through a regular juce::AudioFormatReader instead
+// (Zoomed in below level 0, those draw level 0 bins)
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+class ImGui_Juce_WaveformSummary    : private juce::Thread
+{
+public:
+    struct Bin
+    {
+        float m_min;
+        float m_max;
+        float m_rms;
+    };
+
+    ImGui_Juce_WaveformSummary(juce::AudioFormatManager& i_audioFormatManager, juce::File const& i_audioFile);
+    ~ImGui_Juce_WaveformSummary() override;
+    ImGui_Juce_WaveformSummary(ImGui_Juce_WaveformSummary const&) = delete;
+
+    ImGui_Juce_WaveformSummary& operator=(ImGui_Juce_WaveformSummary const&) = delete;
+    bool operator==(ImGui_Juce_WaveformSummary const&) = delete;
+    bool operator!=(ImGui_Juce_WaveformSummary const&) = delete;
+
+    //==============================================================================
+    // Note: Safe to call from any thread, e.g. the render thread while the summary is building
+    bool IsValid() const;   // false if the file couldn't be opened
+    bool IsBuilt() const;
+    float GetBuildProgress() const; // 0 - 1
+
+    int GetNumChannels() const;
+    juce::int64 GetLengthInSamples() const;
+    double GetSampleRate() const;
+
+    //==============================================================================
+    // Summarises i_channel over [i_startSample, i_endSample) into o_bin, from the coarsest level with at most i_samplesPerBin samples per bin
+    // Returns false when that part of the summary isn't built yet (or is outside the file)
+    // Note: Render thread (block reads raw samples from its own memory-mapped reader when i_samplesPerBin < s_baseSamplesPerBin)
+    bool GetRange(int i_channel, juce::int64 i_startSample, juce::int64 i_endSample, double i_samplesPerBin, Bin& o_bin) const;
+
+    //==============================================================================
+    static constexpr int s_baseSamplesPerBin = 256;
+    static constexpr int s_levelFactor = 4;
+
+private:
+    //==============================================================================
+    struct Level
+    {
+        juce::int64 m_samplesPerBin = 0;
+        juce::int64 m_numBins = 0;
+        std::vector<Bin> m_bins;                            // [bin * numChannels + channel]
+        std::atomic<juce::int64> m_numBinsReady { 0 };      // Bins [0, m_numBinsReady) are built (release / acquire)
+    };
+
+    //==============================================================================
+    // juce::Thread override: builds the pyramid
+    void run() override;
+
+    void BuildBaseBins(juce::AudioBuffer<float> const& i_block, int i_numSamples, juce::int64 i_firstBin);
+    void BuildParentBins(bool i_isFinalBlock);
+
+    int FindLevel(double i_samplesPerBin) const;
+    bool GetRawRange(int i_channel, juce::int64 i_startSample, juce::int64 i_endSample, Bin& o_bin) const;
+
+    //==============================================================================
+    static constexpr int s_blockSize = s_baseSamplesPerBin * 256;
+    static constexpr int s_maxRawChannels = 32;
+
+    //==============================================================================
+    // Constructor initialisation order:
+    std::unique_ptr<juce::AudioFormatReader> m_buildReader;         // Background thread only
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> m_rawReader; // Render thread only, nullptr if not memory-mapped
+
+    //==============================================================================
+    int m_numChannels = 0;
+    juce::int64 m_lengthInSamples = 0;
+    double m_sampleRate = 0.0;
+    std::vector<std::unique_ptr<Level>> m_levels;
+};
+
+//==============================================================================
+// Draws i_channel of [i_viewStartSample, i_viewEndSample): min / max peaks and RMS, one column per framebuffer pixel
+// i_size: as ImGui::InvisibleButton() (<= 0: fill the available width / height). Returns true when clicked (e.g. to seek)
+bool ImGui_Juce_Waveform(char const* i_label
+                        , ImGui_Juce_WaveformSummary const& i_waveformSummary
+                        , int i_channel
+                        , double i_viewStartSample
+                        , double i_viewEndSample
+                        , ImVec2 i_size);
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,336 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Render-to-texture window cache for the Juce Platform Backend
+// See imgui_impl_juce_window_cache.h for usage
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_juce_window_cache.h"
+#include "imgui_internal.h" // ImGuiWindow, ImHashData(), ImGui::FindWindowByID()
+
+//==============================================================================
+static bool ImGui_ImplJuce_IsWindowActiveAndVisible
+(
+    ImGuiWindow const& i_window
+)
+{
+    // Mirrors the (static) check ImGui uses when adding windows to the ImDrawData
+    return i_window.Active && !i_window.Hidden;
+}
+
+//==============================================================================
+static void ImGui_ImplJuce_GatherWindowDrawLists
+(
+    ImGuiWindow& i_window
+    , ImDrawData const& i_drawData
+    , ImVector<ImDrawList*>& o_windowDrawLists
+)
+{
+    // Note: Empty draw lists are not added to the ImDrawData by ImGui, so only gather those which are present
+    if(i_drawData.CmdLists.contains(i_window.DrawList))
+    {
+        o_windowDrawLists.push_back(i_window.DrawList);
+    }
+
+    for(ImGuiWindow* const childWindow : i_window.DC.ChildWindows)
+    {
+        if(ImGui_ImplJuce_IsWindowActiveAndVisible(*childWindow))
+        {
+            ImGui_ImplJuce_GatherWindowDrawLists(*childWindow, i_drawData, o_windowDrawLists);
+        }
+    }
+}
+
+//==============================================================================
+static void ImGui_ImplJuce_SetPremultipliedAlphaBlending
+(
+    [[maybe_unused]] ImDrawList const* i_drawList
+    , [[maybe_unused]] ImDrawCmd const* i_drawCmd
+)
+{
+    using namespace juce::gl;
+
+    // The cached framebuffer textures were rendered with ImGui's alpha blending onto a transparent target
+    // Which results in premultiplied alpha, so composite them without multiplying by alpha a second time
+    glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+//==============================================================================
+ImGui_Juce_WindowCache::ImGui_Juce_WindowCache
+(
+    juce::OpenGLContext& i_openGLContext
+    , ImGuiContext& i_imGuiContext
+    , RenderDrawDataFunction i_renderDrawDataFunction
+)   : m_openGLContext(i_openGLContext)
+    , m_imGuiContext(i_imGuiContext)
+    , m_renderDrawDataFunction(std::move(i_renderDrawDataFunction))
+{
+    jassert(m_renderDrawDataFunction);
+}
+
+//==============================================================================
+ImGui_Juce_WindowCache::~ImGui_Juce_WindowCache()
+{
+    // Note: ReleaseCachedTextures() must have been called on the render thread (openGLContextClosing()) prior to destruction
+    // Otherwise the juce::OpenGLFrameBuffer destructors attempt to release their resources without an active openGL context
+    m_cachedWindows.clear();
+}
+
+//==============================================================================
+void ImGui_Juce_WindowCache::SetWindowCached
+(
+    char const* i_windowName
+    , bool const i_cached
+)
+{
+    // Note: Root window IDs are the hash of their name (See: ImGui::FindWindowByName())
+    ImGuiID const windowID = ImHashStr(i_windowName);
+
+    if(i_cached)
+    {
+        if(m_cachedWindows.find(windowID) == m_cachedWindows.end())
+        {
+            m_cachedWindows.emplace(windowID, std::make_unique<CachedWindow>());
+        }
+
+        return;
+    }
+
+    m_cachedWindows.erase(windowID);
+}
+
+//==============================================================================
+bool ImGui_Juce_WindowCache::IsWindowCached
+(
+    char const* i_windowName
+) const
+{
+    return m_cachedWindows.find(ImHashStr(i_windowName)) != m_cachedWindows.end();
+}
+
+//==============================================================================
+void ImGui_Juce_WindowCache::ProcessDrawData
+(
+    ImDrawData& io_drawData
+)
+{
+    ImGui::SetCurrentContext(&m_imGuiContext);
+    jassert(ImGui::GetCurrentContext() == &m_imGuiContext);
+
+    m_numWindowsRedrawnLastFrame = 0;
+
+    if(!io_drawData.Valid)
+    {
+        return;
+    }
+
+    for(auto& [windowID, cachedWindow] : m_cachedWindows)
+    {
+        ImGuiWindow* const window = ImGui::FindWindowByID(windowID);
+
+        if(window == nullptr || !ImGui_ImplJuce_IsWindowActiveAndVisible(*window))
+        {
+            continue; // not submitted this frame
+        }
+
+        m_windowDrawLists.resize(0);
+        ImGui_ImplJuce_GatherWindowDrawLists(*window, io_drawData, m_windowDrawLists);
+
+        if(m_windowDrawLists.empty())
+        {
+            continue; // nothing to draw
+        }
+
+        if(UpdateCachedWindow(*cachedWindow, *window, io_drawData))
+        {
+            m_numWindowsRedrawnLastFrame++;
+        }
+
+        if(cachedWindow->m_frameBuffer.isValid())
+        {
+            ReplaceWindowDrawLists(*cachedWindow, *window, io_drawData);
+        }
+    }
+}
+
+//==============================================================================
+void ImGui_Juce_WindowCache::ReleaseCachedTextures()
+{
+    for(auto& [windowID, cachedWindow] : m_cachedWindows)
+    {
+        cachedWindow->m_frameBuffer.release();
+        cachedWindow->m_drawCommandsHash = 0; // force a redraw when next used
+    }
+}
+
+//==============================================================================
+int ImGui_Juce_WindowCache::GetNumWindowsRedrawnLastFrame() const
+{
+    return m_numWindowsRedrawnLastFrame;
+}
+
+//==============================================================================
+bool ImGui_Juce_WindowCache::UpdateCachedWindow
+(
+    CachedWindow& io_cachedWindow
+    , ImGuiWindow& i_window
+    , ImDrawData const& i_drawData
+)
+{
+    /**
+     * Note: The draw commands are hashed rather than compared against a copy
+     * ImDrawCmd is memset on construction (See: ImDrawCmd()), so its padding bytes hash deterministically
+     * Vertex positions are in screen space, so moving the window also invalidates the cached texture
+     * */
+
+    ImU32 drawCommandsHash = 0;
+    for(ImDrawList const* const drawList : m_windowDrawLists)
+    {
+        drawCommandsHash = ImHashData(drawList->CmdBuffer.Data, static_cast<size_t>(drawList->CmdBuffer.size_in_bytes()), drawCommandsHash);
+        drawCommandsHash = ImHashData(drawList->IdxBuffer.Data, static_cast<size_t>(drawList->IdxBuffer.size_in_bytes()), drawCommandsHash);
+        drawCommandsHash = ImHashData(drawList->VtxBuffer.Data, static_cast<size_t>(drawList->VtxBuffer.size_in_bytes()), drawCommandsHash);
+    }
+
+    ImGuiWindow const* const hoveredWindow = m_imGuiContext.HoveredWindow;
+    bool const hovered = (hoveredWindow != nullptr) && (hoveredWindow->RootWindow == &i_window);
+    float const renderingScale = i_drawData.FramebufferScale.x;
+
+    juce::OpenGLFrameBuffer& frameBuffer = io_cachedWindow.m_frameBuffer;
+
+    bool const cacheIsValid = frameBuffer.isValid()
+                            && drawCommandsHash == io_cachedWindow.m_drawCommandsHash
+                            && i_window.Size.x == io_cachedWindow.m_size.x
+                            && i_window.Size.y == io_cachedWindow.m_size.y
+                            && renderingScale == io_cachedWindow.m_renderingScale
+                            && hovered == io_cachedWindow.m_hovered;
+
+    if(cacheIsValid)
+    {
+        return false;
+    }
+
+    int const frameBufferWidth = static_cast<int>(std::ceil(i_window.Size.x * renderingScale));
+    int const frameBufferHeight = static_cast<int>(std::ceil(i_window.Size.y * renderingScale));
+
+    if(frameBufferWidth <= 0 || frameBufferHeight <= 0)
+    {
+        return false;
+    }
+
+    if(!frameBuffer.isValid() || frameBuffer.getWidth() != frameBufferWidth || frameBuffer.getHeight() != frameBufferHeight)
+    {
+        frameBuffer.release();
+
+        if(!frameBuffer.initialise(m_openGLContext, frameBufferWidth, frameBufferHeight))
+        {
+            jassertfalse; // failed to create the openGL framebuffer
+            return false;
+        }
+    }
+
+    if(!frameBuffer.makeCurrentRenderingTarget())
+    {
+        jassertfalse;
+        return false;
+    }
+
+    juce::OpenGLHelpers::clear(juce::Colours::transparentBlack);
+
+    // Render the window's draw lists in window space, i.e. the window's top left maps to the framebuffer's top left
+    m_windowDrawData.Clear();
+    m_windowDrawData.CmdLists.swap(m_windowDrawLists); // swap rather than copy, to reuse the allocated storage
+    m_windowDrawData.Valid = true;
+    m_windowDrawData.CmdListsCount = m_windowDrawData.CmdLists.Size;
+    m_windowDrawData.DisplayPos = i_window.Pos;
+    m_windowDrawData.DisplaySize = ImVec2(static_cast<float>(frameBufferWidth) / renderingScale, static_cast<float>(frameBufferHeight) / renderingScale);
+    m_windowDrawData.FramebufferScale = i_drawData.FramebufferScale;
+
+    for(ImDrawList const* const drawList : m_windowDrawData.CmdLists)
+    {
+        m_windowDrawData.TotalVtxCount += drawList->VtxBuffer.Size;
+        m_windowDrawData.TotalIdxCount += drawList->IdxBuffer.Size;
+    }
+
+    m_renderDrawDataFunction(&m_windowDrawData);
+
+    m_windowDrawData.CmdLists.swap(m_windowDrawLists);
+    frameBuffer.releaseAsRenderingTarget();
+
+    io_cachedWindow.m_drawCommandsHash = drawCommandsHash;
+    io_cachedWindow.m_size = i_window.Size;
+    io_cachedWindow.m_renderingScale = renderingScale;
+    io_cachedWindow.m_hovered = hovered;
+
+    return true;
+}
+
+//==============================================================================
+void ImGui_Juce_WindowCache::ReplaceWindowDrawLists
+(
+    CachedWindow& io_cachedWindow
+    , ImGuiWindow& i_window
+    , ImDrawData& io_drawData
+)
+{
+    juce::OpenGLFrameBuffer const& frameBuffer = io_cachedWindow.m_frameBuffer;
+    float const renderingScale = io_cachedWindow.m_renderingScale;
+
+    if(io_cachedWindow.m_compositeDrawList == nullptr)
+    {
+        io_cachedWindow.m_compositeDrawList = std::make_unique<ImDrawList>(ImGui::GetDrawListSharedData());
+    }
+
+    ImDrawList& compositeDrawList = *io_cachedWindow.m_compositeDrawList;
+
+    ImTextureID const textureID = (ImTextureID)(intptr_t)frameBuffer.getTextureID();
+    ImVec2 const textureSize(static_cast<float>(frameBuffer.getWidth()) / renderingScale, static_cast<float>(frameBuffer.getHeight()) / renderingScale);
+
+    // Note: openGL framebuffer textures are stored bottom-up, hence the flipped V coordinates
+    compositeDrawList._ResetForNewFrame();
+    compositeDrawList.PushTextureID(textureID);
+    compositeDrawList.PushClipRect(io_drawData.DisplayPos, ImVec2(io_drawData.DisplayPos.x + io_drawData.DisplaySize.x, io_drawData.DisplayPos.y + io_drawData.DisplaySize.y));
+    compositeDrawList.AddCallback(ImGui_ImplJuce_SetPremultipliedAlphaBlending, nullptr);
+    compositeDrawList.AddImage(textureID, i_window.Pos, ImVec2(i_window.Pos.x + textureSize.x, i_window.Pos.y + textureSize.y), ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f));
+    compositeDrawList.AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+    compositeDrawList.PopClipRect();
+    compositeDrawList.PopTextureID();
+    compositeDrawList._PopUnusedDrawCmd();
+
+    // Replace the window's draw lists (kept in ImGui's draw order) with the single composite draw list
+    int writeIndex = 0;
+    bool compositeDrawListInserted = false;
+
+    for(int readIndex = 0; readIndex < io_drawData.CmdLists.Size; readIndex++)
+    {
+        ImDrawList* drawList = io_drawData.CmdLists[readIndex];
+
+        if(m_windowDrawLists.contains(drawList))
+        {
+            io_drawData.TotalVtxCount -= drawList->VtxBuffer.Size;
+            io_drawData.TotalIdxCount -= drawList->IdxBuffer.Size;
+
+            if(compositeDrawListInserted)
+            {
+                continue; // remove
+            }
+
+            drawList = &compositeDrawList;
+            compositeDrawListInserted = true;
+
+            io_drawData.TotalVtxCount += drawList->VtxBuffer.Size;
+            io_drawData.TotalIdxCount += drawList->IdxBuffer.Size;
+        }
+
+        io_drawData.CmdLists[writeIndex++] = drawList;
+    }
+
+    io_drawData.CmdLists.resize(writeIndex);
+    io_drawData.CmdListsCount = writeIndex;
+}
+
+#endif // #ifndef IMGUI_DISABLE
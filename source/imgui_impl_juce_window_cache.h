@@ -0,0 +1,106 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// dear imgui: Render-to-texture window cache for the Juce Platform Backend
+// Renders chosen ImGui windows (e.g. preset browsers, settings panels) into juce::OpenGLFrameBuffer textures
+// A cached window is only redrawn when its draw commands, size or hover state change, otherwise its cached texture is composited
+// Note: ImGui still submits the cached windows every frame (required for interaction), the saving is the GPU fill / renderer upload
+
+// Usage (render thread, within juce::OpenGLRenderer::renderOpenGL()):
+//  ImGui::Render();
+//  m_imGuiWindowCache.ProcessDrawData(*ImGui::GetDrawData());
+//  ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+// And release the cached textures within juce::OpenGLRenderer::openGLContextClosing():
+//  m_imGuiWindowCache.ReleaseCachedTextures();
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+#include <juce_opengl/juce_opengl.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+
+struct ImGuiWindow;
+
+//==============================================================================
+class ImGui_Juce_WindowCache
+{
+public:
+    // Renders the ImDrawData into the currently bound framebuffer
+    // E.g. [](ImDrawData* i_drawData){ ImGui_ImplOpenGL3_RenderDrawData(i_drawData); }
+    using RenderDrawDataFunction = std::function<void(ImDrawData*)>;
+
+    ImGui_Juce_WindowCache(juce::OpenGLContext& i_openGLContext
+                        , ImGuiContext& i_imGuiContext
+                        , RenderDrawDataFunction i_renderDrawDataFunction);
+    ~ImGui_Juce_WindowCache();
+    ImGui_Juce_WindowCache(ImGui_Juce_WindowCache const&) = delete;
+
+    ImGui_Juce_WindowCache& operator=(ImGui_Juce_WindowCache const&) = delete;
+    bool operator==(ImGui_Juce_WindowCache const&) = delete;
+    bool operator!=(ImGui_Juce_WindowCache const&) = delete;
+
+    //==============================================================================
+    // Opt a (root) ImGui window in/out of caching, by the name passed to ImGui::Begin()
+    // Note: Must be called from the render thread, as un-caching a window releases its openGL framebuffer
+    void SetWindowCached(char const* i_windowName, bool i_cached);
+    bool IsWindowCached(char const* i_windowName) const;
+
+    //==============================================================================
+    // Call after ImGui::Render() and before rendering the draw data (render thread)
+    // Replaces the draw lists of each cached window (and its child windows) with a single textured quad
+    void ProcessDrawData(ImDrawData& io_drawData);
+
+    //==============================================================================
+    // Releases all openGL framebuffers. Call from juce::OpenGLRenderer::openGLContextClosing()
+    void ReleaseCachedTextures();
+
+    //==============================================================================
+    // Number of cached windows re-rendered into their texture during the last ProcessDrawData() (diagnostics)
+    int GetNumWindowsRedrawnLastFrame() const;
+
+private:
+    //==============================================================================
+    struct CachedWindow
+    {
+        juce::OpenGLFrameBuffer m_frameBuffer;
+        std::unique_ptr<ImDrawList> m_compositeDrawList;
+        ImU32 m_drawCommandsHash = 0;
+        ImVec2 m_size = ImVec2(0.0f, 0.0f);
+        float m_renderingScale = 0.0f;
+        bool m_hovered = false;
+    };
+
+    //==============================================================================
+    // Returns true if the cached window's texture was re-rendered
+    bool UpdateCachedWindow(CachedWindow& io_cachedWindow
+                        , ImGuiWindow& i_window
+                        , ImDrawData const& i_drawData);
+    void ReplaceWindowDrawLists(CachedWindow& io_cachedWindow
+                        , ImGuiWindow& i_window
+                        , ImDrawData& io_drawData);
+
+    //==============================================================================
+    // Constructor initialisation order:
+    juce::OpenGLContext& m_openGLContext;
+    ImGuiContext& m_imGuiContext;
+    RenderDrawDataFunction m_renderDrawDataFunction;
+
+    //==============================================================================
+    std::map<ImGuiID, std::unique_ptr<CachedWindow>> m_cachedWindows;
+
+    // Scratch storage reused each frame (avoids per-frame allocations)
+    ImVector<ImDrawList*> m_windowDrawLists;
+    ImDrawData m_windowDrawData;
+
+    int m_numWindowsRedrawnLastFrame = 0;
+};
+
+#endif // #ifndef IMGUI_DISABLE
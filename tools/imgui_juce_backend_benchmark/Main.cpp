@@ -0,0 +1,282 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// Standalone benchmark for ImGui_Juce_Backend::NewFrame(), per feature selection (See: ImGui_Juce_BackendFeatures)
+// Times the render thread frame (ImGui_Juce_Backend::NewFrame(), ImGui::NewFrame(), a small window, ImGui::Render()), without any draw calls
+// Including the per-frame message thread post (See: UpdateOnMessageThread()), skipped by instances without input / cursor features
+// Usage: ImGuiJuceBackendBenchmark [--frames N]
+// See README.md in this directory for build instructions
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_opengl/juce_opengl.h>
+
+#include "imgui.h"
+#include "imgui_impl_juce.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+//==============================================================================
+namespace BackendBenchmark
+{
+    struct Options
+    {
+        int m_frames = 2000;
+    };
+
+    struct Configuration
+    {
+        char const* m_name;
+        ImGui_Juce_BackendFeatures m_features;
+    };
+
+    // Benchmarked in turn, on the same component / openGL context
+    static std::vector<Configuration> const s_configurations
+    {
+        { "all features", ImGui_Juce_BackendFeatures{} },
+        { "display only (no input, cursor or clipboard)", ImGui_Juce_BackendFeatures{ false, false, false, false } }
+    };
+
+    //==============================================================================
+    static juce::Result ParseCommandLine
+    (
+        juce::String const& i_commandLine
+        , Options& o_options
+    )
+    {
+        juce::StringArray const arguments = juce::StringArray::fromTokens(i_commandLine, true);
+
+        for(int i = 0; i < arguments.size(); i++)
+        {
+            juce::String const argument = arguments[i].unquoted();
+
+            if(argument == "--frames" && i + 1 < arguments.size())
+            {
+                o_options.m_frames = juce::jmax(1, arguments[++i].getIntValue());
+            }
+            else
+            {
+                return juce::Result::fail("Usage: ImGuiJuceBackendBenchmark [--frames N]");
+            }
+        }
+
+        return juce::Result::ok();
+    }
+
+    //==============================================================================
+    static void PrintStatistics
+    (
+        juce::String const& i_name
+        , std::vector<double>& io_frameTimesUs
+    )
+    {
+        if(io_frameTimesUs.empty())
+        {
+            return;
+        }
+
+        std::sort(io_frameTimesUs.begin(), io_frameTimesUs.end());
+
+        double total = 0.0;
+        for(double const frameTimeUs : io_frameTimesUs)
+        {
+            total += frameTimeUs;
+        }
+
+        auto const percentile = [&io_frameTimesUs](double const i_percentile)
+        {
+            size_t const index = static_cast<size_t>(i_percentile * static_cast<double>(io_frameTimesUs.size() - 1));
+            return io_frameTimesUs[index];
+        };
+
+        std::cout << i_name << ": frames " << io_frameTimesUs.size()
+                  << ", mean " << (total / static_cast<double>(io_frameTimesUs.size())) << " us"
+                  << ", p50 " << percentile(0.5) << " us"
+                  << ", p99 " << percentile(0.99) << " us"
+                  << ", max " << io_frameTimesUs.back() << " us" << std::endl;
+    }
+}
+
+//==============================================================================
+class BackendBenchmarkComponent : public juce::Component
+                                , public juce::OpenGLRenderer
+                                , private juce::Timer
+{
+public:
+    explicit BackendBenchmarkComponent(BackendBenchmark::Options const& i_options)
+        : m_options(i_options)
+    {
+        setSize(640, 480);
+
+        m_openGLContext.setRenderer(this);
+        m_openGLContext.setContinuousRepainting(true);
+        StartConfiguration();
+        m_openGLContext.attachTo(*this);
+
+        // Polls for the end of each configuration's frames
+        startTimerHz(10);
+    }
+
+    ~BackendBenchmarkComponent() override
+    {
+        stopTimer();
+        m_openGLContext.detach();
+        FinishConfiguration();
+    }
+
+    //==============================================================================
+    void newOpenGLContextCreated() override
+    {
+    }
+
+    void renderOpenGL() override
+    {
+        ImGuiContext* const imGuiContext = m_imGuiContext.load();
+        if(imGuiContext == nullptr || static_cast<int>(m_renderFrameTimesUs.size()) >= m_options.m_frames)
+        {
+            return;
+        }
+
+        ImGui::SetCurrentContext(imGuiContext);
+
+        juce::int64 const startTicks = juce::Time::getHighResolutionTicks();
+
+        m_imGuiBackend->NewFrame();
+        ImGui::NewFrame();
+
+        ImGui::Begin("Benchmark");
+        ImGui::Text("Frame %d", static_cast<int>(m_renderFrameTimesUs.size()));
+        ImGui::End();
+
+        ImGui::Render();
+
+        juce::int64 const endTicks = juce::Time::getHighResolutionTicks();
+
+        m_renderFrameTimesUs.push_back(juce::Time::highResolutionTicksToSeconds(endTicks - startTicks) * 1000000.0);
+
+        if(static_cast<int>(m_renderFrameTimesUs.size()) == m_options.m_frames)
+        {
+            m_renderFinished = true;
+        }
+    }
+
+    void openGLContextClosing() override
+    {
+    }
+
+private:
+    //==============================================================================
+    void StartConfiguration()
+    {
+        BackendBenchmark::Configuration const& configuration = BackendBenchmark::s_configurations[m_configurationIndex];
+
+        ImGuiContext* const imGuiContext = ImGui::CreateContext();
+        ImGui::SetCurrentContext(imGuiContext);
+
+        // No renderer backend: the font atlas is built up front, as ImGui::NewFrame() requires
+        ImGuiIO& io = ImGui::GetIO();
+        io.Fonts->AddFontDefault();
+        io.Fonts->Build();
+        io.IniFilename = nullptr;
+
+        m_imGuiBackend = std::make_unique<ImGui_Juce_Backend>(*this, m_openGLContext, *imGuiContext, 1.0f, true, configuration.m_features);
+        m_renderFrameTimesUs.clear();
+        m_renderFrameTimesUs.reserve(static_cast<size_t>(m_options.m_frames));
+        m_renderFinished = false;
+
+        m_imGuiContext = imGuiContext;
+    }
+
+    void FinishConfiguration()
+    {
+        ImGuiContext* const imGuiContext = m_imGuiContext.exchange(nullptr);
+        if(imGuiContext == nullptr)
+        {
+            return;
+        }
+
+        m_imGuiBackend.reset();
+        ImGui::DestroyContext(imGuiContext);
+    }
+
+    //==============================================================================
+    void timerCallback() override
+    {
+        if(m_imGuiContext.load() == nullptr || !m_renderFinished)
+        {
+            return;
+        }
+
+        // Render thread stopped producing frames (See: renderOpenGL()), its results are safe to read
+        BackendBenchmark::Configuration const& configuration = BackendBenchmark::s_configurations[m_configurationIndex];
+        BackendBenchmark::PrintStatistics(configuration.m_name, m_renderFrameTimesUs);
+
+        m_openGLContext.detach();
+        FinishConfiguration();
+
+        m_configurationIndex++;
+        if(m_configurationIndex == BackendBenchmark::s_configurations.size())
+        {
+            stopTimer();
+            juce::MessageManager::callAsync([](){ juce::JUCEApplicationBase::quit(); });
+            return;
+        }
+
+        StartConfiguration();
+        m_openGLContext.attachTo(*this);
+    }
+
+    //==============================================================================
+    BackendBenchmark::Options m_options;
+    juce::OpenGLContext m_openGLContext;
+    std::unique_ptr<ImGui_Juce_Backend> m_imGuiBackend;
+    std::atomic<ImGuiContext*> m_imGuiContext { nullptr };
+    std::atomic<bool> m_renderFinished { false };
+
+    size_t m_configurationIndex = 0;
+    std::vector<double> m_renderFrameTimesUs;   // render thread only, until m_renderFinished
+};
+
+//==============================================================================
+class BackendBenchmarkApplication : public juce::JUCEApplication
+{
+public:
+    juce::String const getApplicationName() override { return "ImGuiJuceBackendBenchmark"; }
+    juce::String const getApplicationVersion() override { return "1.0.0"; }
+    bool moreThanOneInstanceAllowed() override { return true; }
+
+    void initialise(juce::String const& i_commandLine) override
+    {
+        BackendBenchmark::Options options;
+        juce::Result const parseResult = BackendBenchmark::ParseCommandLine(i_commandLine, options);
+
+        if(parseResult.failed())
+        {
+            std::cout << parseResult.getErrorMessage() << std::endl;
+            setApplicationReturnValue(1);
+            quit();
+            return;
+        }
+
+        m_window = std::make_unique<juce::DocumentWindow>(getApplicationName(), juce::Colours::black, juce::DocumentWindow::closeButton);
+        m_window->setUsingNativeTitleBar(true);
+        m_window->setContentOwned(new BackendBenchmarkComponent(options), true);
+        m_window->setVisible(true);
+    }
+
+    void shutdown() override
+    {
+        m_window.reset();
+    }
+
+private:
+    std::unique_ptr<juce::DocumentWindow> m_window;
+};
+
+START_JUCE_APPLICATION(BackendBenchmarkApplication)
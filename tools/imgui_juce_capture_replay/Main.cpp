@@ -0,0 +1,328 @@
+/*
+* ==============================================================================
+* This file is part of the Nature Is Frequency - JUCE-imgui distribution (https://github.com/NatureIsFrequency/JUCE-imgui).
+* Copyright(c) 2024 Nature Is Frequency
+* ==============================================================================
+*/
+
+// Standalone replay tool for ImDrawData captures (See: source/imgui_impl_juce_capture.h)
+// Streams every captured frame through a renderer, repeatedly, and reports per-frame render times
+// Usage: ImGuiJuceCaptureReplay <capture file> [--iterations N] [--renderer opengl3|juce|all]
+// See README.md in this directory for build instructions
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_opengl/juce_opengl.h>
+
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include "imgui_impl_juce_capture.h"
+#include "imgui_impl_juce_opengl_renderer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+//==============================================================================
+namespace CaptureReplay
+{
+    enum class Renderer
+    {
+        OpenGL3,    // imgui_impl_opengl3
+        Juce        // ImGui_Juce_OpenGLRenderer (source/imgui_impl_juce_opengl_renderer.h)
+    };
+
+    struct Options
+    {
+        juce::File m_captureFile;
+        int m_iterations = 10;
+        std::vector<Renderer> m_renderers { Renderer::OpenGL3 }; // benchmarked in turn, on the same capture
+    };
+
+    //==============================================================================
+    static char const* GetRendererName
+    (
+        Renderer const i_renderer
+    )
+    {
+        switch(i_renderer)
+        {
+            case Renderer::OpenGL3: return "imgui_impl_opengl3";
+            case Renderer::Juce: return "imgui_impl_juce_opengl_renderer";
+        }
+
+        return "";
+    }
+
+    //==============================================================================
+    static juce::Result ParseCommandLine
+    (
+        juce::String const& i_commandLine
+        , Options& o_options
+    )
+    {
+        juce::StringArray const arguments = juce::StringArray::fromTokens(i_commandLine, true);
+
+        for(int i = 0; i < arguments.size(); i++)
+        {
+            juce::String const argument = arguments[i].unquoted();
+
+            if(argument == "--iterations" && i + 1 < arguments.size())
+            {
+                o_options.m_iterations = juce::jmax(1, arguments[++i].getIntValue());
+            }
+            else if(argument == "--renderer" && i + 1 < arguments.size())
+            {
+                juce::String const renderer = arguments[++i].unquoted();
+
+                if(renderer == "opengl3")
+                {
+                    o_options.m_renderers = { Renderer::OpenGL3 };
+                }
+                else if(renderer == "juce")
+                {
+                    o_options.m_renderers = { Renderer::Juce };
+                }
+                else if(renderer == "all")
+                {
+                    o_options.m_renderers = { Renderer::OpenGL3, Renderer::Juce };
+                }
+                else
+                {
+                    return juce::Result::fail("Unknown renderer: " + renderer);
+                }
+            }
+            else
+            {
+                o_options.m_captureFile = juce::File::getCurrentWorkingDirectory().getChildFile(argument);
+            }
+        }
+
+        if(!o_options.m_captureFile.existsAsFile())
+        {
+            return juce::Result::fail("Usage: ImGuiJuceCaptureReplay <capture file> [--iterations N] [--renderer opengl3|juce|all]");
+        }
+
+        return juce::Result::ok();
+    }
+
+    //==============================================================================
+    static void PrintStatistics
+    (
+        juce::String const& i_name
+        , std::vector<double>& io_frameTimesMs
+    )
+    {
+        if(io_frameTimesMs.empty())
+        {
+            return;
+        }
+
+        std::sort(io_frameTimesMs.begin(), io_frameTimesMs.end());
+
+        double total = 0.0;
+        for(double const frameTimeMs : io_frameTimesMs)
+        {
+            total += frameTimeMs;
+        }
+
+        auto const percentile = [&io_frameTimesMs](double const i_percentile)
+        {
+            size_t const index = static_cast<size_t>(i_percentile * static_cast<double>(io_frameTimesMs.size() - 1));
+            return io_frameTimesMs[index];
+        };
+
+        std::cout << i_name << ": frames " << io_frameTimesMs.size()
+                  << ", mean " << (total / static_cast<double>(io_frameTimesMs.size())) << " ms"
+                  << ", p50 " << percentile(0.5) << " ms"
+                  << ", p99 " << percentile(0.99) << " ms"
+                  << ", max " << io_frameTimesMs.back() << " ms" << std::endl;
+    }
+}
+
+//==============================================================================
+class CaptureReplayComponent    : public juce::Component
+                                , public juce::OpenGLRenderer
+{
+public:
+    explicit CaptureReplayComponent(CaptureReplay::Options const& i_options)
+        : m_options(i_options)
+    {
+        juce::Result const openResult = m_captureReader.Open(m_options.m_captureFile);
+
+        if(openResult.failed() || m_captureReader.GetNumFrames() == 0)
+        {
+            std::cout << (openResult.failed() ? openResult.getErrorMessage() : juce::String("Capture contains no frames")) << std::endl;
+            juce::JUCEApplicationBase::quit();
+            return;
+        }
+
+        JuceImGuiCapture::FrameHeader const& firstFrame = m_captureReader.GetFrameHeader(0);
+        setSize(juce::jmax(1, juce::roundToInt(firstFrame.m_displaySize[0])), juce::jmax(1, juce::roundToInt(firstFrame.m_displaySize[1])));
+
+        m_openGLContext.setRenderer(this);
+        m_openGLContext.setContinuousRepainting(true);
+        m_openGLContext.attachTo(*this);
+    }
+
+    ~CaptureReplayComponent() override
+    {
+        m_openGLContext.detach();
+    }
+
+    //==============================================================================
+    void newOpenGLContextCreated() override
+    {
+        m_imGuiContext = ImGui::CreateContext();
+        ImGui::SetCurrentContext(m_imGuiContext);
+
+        ImGuiIO& io = ImGui::GetIO();
+        io.Fonts->AddFontDefault();
+
+        ImGui_ImplOpenGL3_Init(juce::OpenGLHelpers::getGLSLVersionString().toRawUTF8());
+        ImGui_ImplOpenGL3_NewFrame(); // creates the font atlas texture
+        m_openGL3FontTextureID = io.Fonts->TexID;
+
+        m_juceRenderer = std::make_unique<ImGui_Juce_OpenGLRenderer>(m_openGLContext);
+        m_juceRenderer->Init();
+
+        // Captured texture IDs are meaningless in this process, so every draw command samples the current renderer's font atlas
+        // (Keeping the texture bandwidth representative of typical ImGui frames)
+        m_captureReader.SetTextureIDRemapFunction([](juce::uint64){ return ImGui::GetIO().Fonts->TexID; });
+    }
+
+    void renderOpenGL() override
+    {
+        using namespace juce::gl;
+
+        if(m_imGuiContext == nullptr || m_currentRendererIndex >= m_options.m_renderers.size())
+        {
+            return;
+        }
+
+        ImGui::SetCurrentContext(m_imGuiContext);
+
+        CaptureReplay::Renderer const renderer = m_options.m_renderers[m_currentRendererIndex];
+        ImGui::GetIO().Fonts->SetTexID(renderer == CaptureReplay::Renderer::Juce ? m_juceRenderer->GetFontsTextureID() : m_openGL3FontTextureID);
+
+        for(int frameIndex = 0; frameIndex < m_captureReader.GetNumFrames(); frameIndex++)
+        {
+            if(!m_captureReader.ReadFrame(frameIndex, m_drawData))
+            {
+                continue; // malformed frame (e.g. a corrupted capture), not timed
+            }
+
+            juce::OpenGLHelpers::clear(juce::Colours::black);
+
+            // Note: glFinish() so the measurement includes the GPU work, not only command submission
+            juce::int64 const startTicks = juce::Time::getHighResolutionTicks();
+
+            switch(renderer)
+            {
+                case CaptureReplay::Renderer::OpenGL3: ImGui_ImplOpenGL3_RenderDrawData(&m_drawData); break;
+                case CaptureReplay::Renderer::Juce: m_juceRenderer->RenderDrawData(m_drawData); break;
+            }
+
+            glFinish();
+            juce::int64 const endTicks = juce::Time::getHighResolutionTicks();
+
+            m_frameTimesMs.push_back(juce::Time::highResolutionTicksToSeconds(endTicks - startTicks) * 1000.0);
+        }
+
+        m_completedIterations++;
+
+        if(m_completedIterations < m_options.m_iterations)
+        {
+            return;
+        }
+
+        CaptureReplay::PrintStatistics(CaptureReplay::GetRendererName(renderer), m_frameTimesMs);
+
+        if(renderer == CaptureReplay::Renderer::Juce)
+        {
+            ImGui_Juce_OpenGLRenderer::Statistics const statistics = m_juceRenderer->GetLastFrameStatistics();
+            std::cout << "    last frame: draw cmds " << statistics.m_numDrawCmds
+                      << ", draw calls " << statistics.m_numDrawCalls
+                      << ", uploaded " << statistics.m_numUploadedBytes << " bytes" << std::endl;
+        }
+
+        m_frameTimesMs.clear();
+        m_completedIterations = 0;
+        m_currentRendererIndex++;
+
+        if(m_currentRendererIndex == m_options.m_renderers.size())
+        {
+            juce::MessageManager::callAsync([](){ juce::JUCEApplicationBase::quit(); });
+        }
+    }
+
+    void openGLContextClosing() override
+    {
+        if(m_imGuiContext == nullptr)
+        {
+            return;
+        }
+
+        ImGui::SetCurrentContext(m_imGuiContext);
+
+        m_juceRenderer->Shutdown();
+        m_juceRenderer.reset();
+
+        ImGui::GetIO().Fonts->SetTexID(m_openGL3FontTextureID);
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui::DestroyContext(m_imGuiContext);
+        m_imGuiContext = nullptr;
+    }
+
+private:
+    //==============================================================================
+    CaptureReplay::Options m_options;
+    juce::OpenGLContext m_openGLContext;
+    ImGui_Juce_DrawDataCaptureReader m_captureReader;
+    ImGuiContext* m_imGuiContext = nullptr;
+    ImDrawData m_drawData;
+
+    std::unique_ptr<ImGui_Juce_OpenGLRenderer> m_juceRenderer;
+    ImTextureID m_openGL3FontTextureID = 0;
+
+    size_t m_currentRendererIndex = 0;
+    int m_completedIterations = 0;
+    std::vector<double> m_frameTimesMs;
+};
+
+//==============================================================================
+class CaptureReplayApplication : public juce::JUCEApplication
+{
+public:
+    juce::String const getApplicationName() override { return "ImGuiJuceCaptureReplay"; }
+    juce::String const getApplicationVersion() override { return "1.0.0"; }
+    bool moreThanOneInstanceAllowed() override { return true; }
+
+    void initialise(juce::String const& i_commandLine) override
+    {
+        CaptureReplay::Options options;
+        juce::Result const parseResult = CaptureReplay::ParseCommandLine(i_commandLine, options);
+
+        if(parseResult.failed())
+        {
+            std::cout << parseResult.getErrorMessage() << std::endl;
+            setApplicationReturnValue(1);
+            quit();
+            return;
+        }
+
+        m_window = std::make_unique<juce::DocumentWindow>(getApplicationName(), juce::Colours::black, juce::DocumentWindow::closeButton);
+        m_window->setUsingNativeTitleBar(true);
+        m_window->setContentOwned(new CaptureReplayComponent(options), true);
+        m_window->setVisible(true);
+    }
+
+    void shutdown() override
+    {
+        m_window.reset();
+    }
+
+private:
+    std::unique_ptr<juce::DocumentWindow> m_window;
+};
+
+START_JUCE_APPLICATION(CaptureReplayApplication)